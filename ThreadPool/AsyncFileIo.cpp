@@ -0,0 +1,912 @@
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+// Модуль ThreadPool, асинхронный файловый ввод-вывод.
+//
+// Версия: 1.0.0.0
+// Дата последнего изменения: 19.10.2026
+//
+// Автор: Маслов А.С. (https://github.com/ArtemMaslov).
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <thread>
+
+// io_uring есть только в Linux. На других системах операции выполняют потоки ввода-вывода.
+#ifdef __linux__
+    #define THREAD_POOL_IO_URING
+#endif
+
+#ifdef THREAD_POOL_IO_URING
+    #include <linux/io_uring.h>
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+    #include <sys/uio.h>
+#endif
+
+#ifdef _WIN32
+    // Макросы min и max из windows.h мешают std::min и std::max.
+    #define NOMINMAX
+    #include <io.h>
+    #include <windows.h>
+#else
+    #include <unistd.h>
+#endif
+
+#include "ThreadPool.h"
+
+using namespace ThreadPoolModule;
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+/// Размер страницы памяти. Буферы выравниваются по нему для чтения с O_DIRECT.
+static const size_t IoPageSize = 4096;
+
+/// Максимальное количество продолжений, выполняемых за один вызов PollCompletions().
+static const size_t CompletionsBatchSize = 32;
+
+/**
+ * @brief Выделить память под буферы, выровненную по IoPageSize.
+*/
+static void* AllocateBuffersMemory(const size_t size);
+
+static void FreeBuffersMemory(void* const memory);
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+namespace ThreadPoolModule
+{
+    /**
+     * @brief Завершённая операция.
+    */
+    struct IoCompletion
+    {
+        /// Операция или nullptr, если это пробуждение ожидающего потока (Wake()).
+        IoOperation* Operation;
+        int64_t      Result;
+    };
+
+    /**
+     * @brief Способ выполнения операций ввода-вывода.
+    */
+    class IoBackend
+    {
+    public:
+        virtual ~IoBackend() = default;
+
+        /**
+         * @brief Отправить операцию.
+         *
+         * @return false, если ядро не принимает операции, пока не забраны завершённые.
+         * Операция не отправлена, её нужно отправить повторно.
+        */
+        virtual bool Submit(IoOperation* const operation) = 0;
+
+        /**
+         * @brief Забрать завершённые операции. Не блокирует поток.
+        */
+        virtual size_t Poll(IoCompletion* const completions, const size_t maxCount) = 0;
+
+        /**
+         * @brief Проверить, есть ли что забрать через Poll(), включая пробуждения Wake().
+         * Не захватывает мьютексов.
+        */
+        virtual bool HasCompletions() const = 0;
+
+        /**
+         * @brief Ожидать завершения операции или вызова Wake().
+        */
+        virtual void Wait() = 0;
+
+        virtual void Wake() = 0;
+
+        virtual void UpdateFile(const size_t fileIndex, const int fd) = 0;
+    };
+}
+
+#ifdef THREAD_POOL_IO_URING
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+//                                      io_uring
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+/**
+ * @brief Операции через io_uring. Используются системные вызовы напрямую, без liburing.
+ *
+ * Очередь отправки защищена мьютексом, очередь завершения забирает один поток за раз.
+*/
+class UringIoBackend : public IoBackend
+{
+public:
+    /**
+     * @brief Создать io_uring и зарегистрировать буферы и таблицу файлов.
+     *
+     * @return nullptr, если ядро не поддерживает io_uring или нужные операции.
+    */
+    static std::unique_ptr<IoBackend> Create(const size_t queueDepth,
+                                             const std::vector<IoBuffer>& buffers,
+                                             const size_t maxFilesCount);
+
+    ~UringIoBackend();
+
+    bool Submit(IoOperation* const operation) override;
+
+    size_t Poll(IoCompletion* const completions, const size_t maxCount) override;
+
+    bool HasCompletions() const override;
+
+    void Wait() override;
+
+    void Wake() override;
+
+    void UpdateFile(const size_t fileIndex, const int fd) override;
+
+private:
+    UringIoBackend() = default;
+
+    bool Setup(const size_t queueDepth);
+
+    bool IsOpCodeSupported(const std::vector<uint8_t>& opCodes);
+
+    /**
+     * @brief Заполнить элемент очереди отправки и отправить его в ядро.
+     *
+     * @return false, если ядро занято или не забрало элемент. Элемент убран из очереди
+     * отправки.
+    */
+    template <typename FillFunct>
+    bool SubmitEntry(FillFunct fill);
+
+    int Enter(const unsigned toSubmit, const unsigned minComplete, const unsigned flags);
+
+    int Register(const unsigned opCode, const void* const arg, const unsigned argsCount);
+
+    int RingFd = -1;
+
+    void*         SqRing     = nullptr;
+    size_t        SqRingSize = 0;
+    void*         CqRing     = nullptr;
+    size_t        CqRingSize = 0;
+    io_uring_sqe* Sqes       = nullptr;
+    size_t        SqesSize   = 0;
+
+    unsigned* SqHead    = nullptr;
+    unsigned* SqTail    = nullptr;
+    unsigned* SqFlags   = nullptr;
+    unsigned  SqMask    = 0;
+    unsigned  SqEntries = 0;
+
+    unsigned*     CqHead = nullptr;
+    unsigned*     CqTail = nullptr;
+    unsigned      CqMask = 0;
+    io_uring_cqe* Cqes   = nullptr;
+
+    /// Контроль над доступом к очереди отправки.
+    std::mutex SubmitAccess;
+    /// Контроль над доступом к очереди завершения.
+    std::mutex CompletionAccess;
+};
+
+std::unique_ptr<IoBackend> UringIoBackend::Create(const size_t queueDepth,
+                                                  const std::vector<IoBuffer>& buffers,
+                                                  const size_t maxFilesCount)
+{
+    std::unique_ptr<UringIoBackend> backend(new UringIoBackend());
+
+    if (!backend->Setup(queueDepth))
+        return nullptr;
+
+    if (!backend->IsOpCodeSupported({ IORING_OP_NOP, IORING_OP_READ, IORING_OP_WRITE,
+                                      IORING_OP_READ_FIXED, IORING_OP_WRITE_FIXED }))
+        return nullptr;
+
+    std::vector<iovec> iovecs(buffers.size());
+    for (size_t st = 0; st < buffers.size(); st++)
+        iovecs[st] = { buffers[st].Data, buffers[st].Size };
+
+    if (!iovecs.empty() && backend->Register(IORING_REGISTER_BUFFERS, iovecs.data(),
+                                             static_cast<unsigned>(iovecs.size())) < 0)
+        return nullptr;
+
+    // Таблица файлов регистрируется сразу целиком, свободные ячейки равны -1.
+    const std::vector<int> files(maxFilesCount, -1);
+    if (!files.empty() && backend->Register(IORING_REGISTER_FILES, files.data(),
+                                            static_cast<unsigned>(files.size())) < 0)
+        return nullptr;
+
+    return backend;
+}
+
+UringIoBackend::~UringIoBackend()
+{
+    if (Sqes != nullptr)
+        munmap(Sqes, SqesSize);
+    if (CqRing != nullptr && CqRing != SqRing)
+        munmap(CqRing, CqRingSize);
+    if (SqRing != nullptr)
+        munmap(SqRing, SqRingSize);
+    if (RingFd >= 0)
+        close(RingFd);
+}
+
+bool UringIoBackend::Setup(const size_t queueDepth)
+{
+    io_uring_params params = {};
+
+    RingFd = static_cast<int>(syscall(__NR_io_uring_setup, static_cast<unsigned>(queueDepth), &params));
+    if (RingFd < 0)
+        return false;
+
+    SqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    CqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+    // Начиная с Linux 5.4 обе очереди отображаются одним вызовом mmap().
+    const bool isSingleMmap = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (isSingleMmap)
+        SqRingSize = CqRingSize = std::max(SqRingSize, CqRingSize);
+
+    void* const sqRing = mmap(nullptr, SqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                              RingFd, IORING_OFF_SQ_RING);
+    if (sqRing == MAP_FAILED)
+        return false;
+    SqRing = sqRing;
+
+    if (isSingleMmap)
+        CqRing = SqRing;
+    else
+    {
+        void* const cqRing = mmap(nullptr, CqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                                  RingFd, IORING_OFF_CQ_RING);
+        if (cqRing == MAP_FAILED)
+            return false;
+        CqRing = cqRing;
+    }
+
+    SqesSize = params.sq_entries * sizeof(io_uring_sqe);
+    void* const sqes = mmap(nullptr, SqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                            RingFd, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED)
+        return false;
+    Sqes = static_cast<io_uring_sqe*>(sqes);
+
+    char* const sqRingBytes = static_cast<char*>(SqRing);
+    SqHead    = reinterpret_cast<unsigned*>(sqRingBytes + params.sq_off.head);
+    SqTail    = reinterpret_cast<unsigned*>(sqRingBytes + params.sq_off.tail);
+    SqFlags   = reinterpret_cast<unsigned*>(sqRingBytes + params.sq_off.flags);
+    SqMask    = *reinterpret_cast<unsigned*>(sqRingBytes + params.sq_off.ring_mask);
+    SqEntries = params.sq_entries;
+
+    // Элемент очереди отправки с номером i всегда находится в ячейке i массива Sqes.
+    unsigned* const sqArray = reinterpret_cast<unsigned*>(sqRingBytes + params.sq_off.array);
+    for (unsigned st = 0; st < SqEntries; st++)
+        sqArray[st] = st;
+
+    char* const cqRingBytes = static_cast<char*>(CqRing);
+    CqHead = reinterpret_cast<unsigned*>(cqRingBytes + params.cq_off.head);
+    CqTail = reinterpret_cast<unsigned*>(cqRingBytes + params.cq_off.tail);
+    CqMask = *reinterpret_cast<unsigned*>(cqRingBytes + params.cq_off.ring_mask);
+    Cqes   = reinterpret_cast<io_uring_cqe*>(cqRingBytes + params.cq_off.cqes);
+
+    return true;
+}
+
+bool UringIoBackend::IsOpCodeSupported(const std::vector<uint8_t>& opCodes)
+{
+    const size_t opsCount = 256;
+    std::vector<char> probeMemory(sizeof(io_uring_probe) + opsCount * sizeof(io_uring_probe_op));
+    io_uring_probe* const probe = reinterpret_cast<io_uring_probe*>(probeMemory.data());
+
+    // IORING_REGISTER_PROBE появился в Linux 5.6 вместе с IORING_OP_READ и IORING_OP_WRITE.
+    if (Register(IORING_REGISTER_PROBE, probe, opsCount) < 0)
+        return false;
+
+    for (const uint8_t opCode: opCodes)
+    {
+        if (opCode > probe->last_op || !(probe->ops[opCode].flags & IO_URING_OP_SUPPORTED))
+            return false;
+    }
+
+    return true;
+}
+
+bool UringIoBackend::Submit(IoOperation* const operation)
+{
+    return SubmitEntry([operation](io_uring_sqe& sqe)
+    {
+        const bool isRead  = operation->Code == IoOperation::OpCode::Read;
+        const bool isFixed = operation->BufferIndex >= 0;
+
+        if (isFixed)
+        {
+            sqe.opcode    = isRead ? IORING_OP_READ_FIXED : IORING_OP_WRITE_FIXED;
+            sqe.buf_index = static_cast<uint16_t>(operation->BufferIndex);
+        }
+        else
+            sqe.opcode = isRead ? IORING_OP_READ : IORING_OP_WRITE;
+
+        sqe.fd        = static_cast<int>(operation->FileIndex);
+        sqe.flags     = IOSQE_FIXED_FILE;
+        sqe.off       = operation->Offset;
+        sqe.addr      = reinterpret_cast<uint64_t>(operation->Data);
+        // Размер не больше AsyncFileIo::MaxIoSize и помещается в 32 бита.
+        sqe.len       = static_cast<uint32_t>(operation->Size);
+        sqe.user_data = reinterpret_cast<uint64_t>(operation);
+    });
+}
+
+size_t UringIoBackend::Poll(IoCompletion* const completions, const size_t maxCount)
+{
+    // Очередь завершения уже разбирает другой поток.
+    std::unique_lock<std::mutex> lock(CompletionAccess, std::try_to_lock);
+    if (!lock.owns_lock())
+        return 0;
+
+    // Если очередь завершения переполнилась, то ядро хранит операции отдельно и переносит
+    // их в очередь только при io_uring_enter().
+    if (std::atomic_ref<unsigned>(*SqFlags).load(std::memory_order_relaxed) & IORING_SQ_CQ_OVERFLOW)
+        Enter(0, 0, IORING_ENTER_GETEVENTS);
+
+    const unsigned head = *CqHead;
+    const unsigned tail = std::atomic_ref<unsigned>(*CqTail).load(std::memory_order_acquire);
+    const size_t   count = std::min<size_t>(tail - head, maxCount);
+
+    for (size_t st = 0; st < count; st++)
+    {
+        const io_uring_cqe& cqe = Cqes[(head + st) & CqMask];
+        completions[st] = { reinterpret_cast<IoOperation*>(cqe.user_data), cqe.res };
+    }
+
+    std::atomic_ref<unsigned>(*CqHead).store(head + static_cast<unsigned>(count),
+                                             std::memory_order_release);
+    return count;
+}
+
+bool UringIoBackend::HasCompletions() const
+{
+    if (std::atomic_ref<unsigned>(*SqFlags).load(std::memory_order_relaxed) & IORING_SQ_CQ_OVERFLOW)
+        return true;
+
+    return std::atomic_ref<unsigned>(*CqHead).load(std::memory_order_relaxed) !=
+           std::atomic_ref<unsigned>(*CqTail).load(std::memory_order_acquire);
+}
+
+void UringIoBackend::Wait()
+{
+    Enter(0, 1, IORING_ENTER_GETEVENTS);
+}
+
+void UringIoBackend::Wake()
+{
+    // Завершение пустой операции прерывает ожидание в Wait(). Если ядро не приняло операцию,
+    // то её нужно отправить повторно: иначе другой поток может забрать завершённые операции
+    // до того, как ожидающий поток войдёт в Wait(), и пробуждение потеряется. Ядро отклоняет
+    // операции, пока очередь завершения переполнена. В это время Wait() не блокирует поток,
+    // поэтому ожидающий поток освободит очередь.
+    const auto fillNop = [](io_uring_sqe& sqe)
+    {
+        sqe.opcode    = IORING_OP_NOP;
+        sqe.user_data = 0;
+    };
+
+    while (!SubmitEntry(fillNop))
+        std::this_thread::yield();
+}
+
+void UringIoBackend::UpdateFile(const size_t fileIndex, const int fd)
+{
+    int fds[1] = { fd };
+
+    io_uring_files_update update = {};
+    update.offset = static_cast<uint32_t>(fileIndex);
+    update.fds    = reinterpret_cast<uint64_t>(fds);
+
+    const int result = Register(IORING_REGISTER_FILES_UPDATE, &update, 1);
+    THREAD_POOL_ASSERT("Failed to update io_uring registered file", result >= 0);
+}
+
+template <typename FillFunct>
+bool UringIoBackend::SubmitEntry(FillFunct fill)
+{
+    std::unique_lock<std::mutex> lock(SubmitAccess);
+
+    // Без SQPOLL ядро забирает все элементы во время io_uring_enter(), поэтому очередь
+    // отправки пуста при каждом добавлении.
+    const unsigned tail = *SqTail;
+
+    io_uring_sqe& sqe = Sqes[tail & SqMask];
+    memset(&sqe, 0, sizeof(sqe));
+    fill(sqe);
+
+    std::atomic_ref<unsigned>(*SqTail).store(tail + 1, std::memory_order_release);
+
+    while (true)
+    {
+        const int result = Enter(1, 0, 0);
+        if (result > 0)
+            return true;
+
+        if (result == -EINTR)
+            continue;
+
+        // Очередь завершения переполнена или ядру не хватило памяти, либо ядро не забрало
+        // элемент без ошибки (результат 0). Ожидать здесь нельзя: добавляющий поток может быть
+        // единственным, кто забирает завершённые операции.
+        THREAD_POOL_ASSERT("io_uring_enter() failed",
+                           result == 0 || result == -EBUSY || result == -EAGAIN);
+
+        // Без SQPOLL ядро читает очередь отправки только в io_uring_enter(), поэтому не
+        // принятый элемент можно убрать из очереди и отправить позже.
+        THREAD_POOL_ASSERT("io_uring consumed rejected entry",
+                           std::atomic_ref<unsigned>(*SqHead).load(std::memory_order_acquire) == tail);
+        std::atomic_ref<unsigned>(*SqTail).store(tail, std::memory_order_release);
+        return false;
+    }
+}
+
+int UringIoBackend::Enter(const unsigned toSubmit, const unsigned minComplete, const unsigned flags)
+{
+    const long result = syscall(__NR_io_uring_enter, RingFd, toSubmit, minComplete, flags, nullptr, 0);
+    return result < 0 ? -errno : static_cast<int>(result);
+}
+
+int UringIoBackend::Register(const unsigned opCode, const void* const arg, const unsigned argsCount)
+{
+    const long result = syscall(__NR_io_uring_register, RingFd, opCode, arg, argsCount);
+    return result < 0 ? -errno : static_cast<int>(result);
+}
+
+#endif // THREAD_POOL_IO_URING
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+//                                  Потоки ввода-вывода
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+/**
+ * @brief Операции выполняются блокирующими pread() / pwrite() в отдельных потоках.
+ *
+ * Используется, если ядро не поддерживает io_uring или система не Linux. Потоки ThreadPool
+ * по-прежнему не блокируются на время операции.
+*/
+class ThreadIoBackend : public IoBackend
+{
+public:
+    ThreadIoBackend(const size_t threadsCount);
+
+    ~ThreadIoBackend();
+
+    bool Submit(IoOperation* const operation) override;
+
+    size_t Poll(IoCompletion* const completions, const size_t maxCount) override;
+
+    bool HasCompletions() const override;
+
+    void Wait() override;
+
+    void Wake() override;
+
+    void UpdateFile(const size_t fileIndex, const int fd) override;
+
+private:
+    void OnRunningThread();
+
+    void StopThreads();
+
+    /**
+     * @brief Выполнить операцию блокирующим вызовом.
+     *
+     * @return Количество байт или -errno.
+    */
+    static int64_t Execute(IoOperation* const operation);
+
+    bool IsTerminating = false;
+
+    /// Контроль над доступом к очереди операций.
+    std::mutex               RequestsAccess;
+    std::condition_variable  RequestsCondition;
+    std::deque<IoOperation*> Requests;
+
+    /// Контроль над доступом к завершённым операциям.
+    std::mutex               CompletionsAccess;
+    std::condition_variable  CompletionsCondition;
+    std::deque<IoCompletion> Completions;
+    /// Размер Completions, доступный без мьютекса.
+    std::atomic<size_t>      CompletionsCount = 0;
+    /// Был вызван Wake(), но Wait() ещё не вернул управление.
+    bool                     IsWakeRequested = false;
+
+    std::vector<std::thread> Threads;
+};
+
+ThreadIoBackend::ThreadIoBackend(const size_t threadsCount)
+{
+    try
+    {
+        for (size_t st = 0; st < std::max<size_t>(threadsCount, 1); st++)
+            Threads.emplace_back(&ThreadIoBackend::OnRunningThread, this);
+    }
+    catch (...)
+    {
+        // В случае исключения созданные потоки будут корректно завершены.
+        StopThreads();
+        throw;
+    }
+}
+
+ThreadIoBackend::~ThreadIoBackend()
+{
+    StopThreads();
+}
+
+void ThreadIoBackend::StopThreads()
+{
+    {
+        std::unique_lock<std::mutex> lock(RequestsAccess);
+        IsTerminating = true;
+    }
+    RequestsCondition.notify_all();
+
+    for (std::thread& thread: Threads)
+    {
+        if (thread.joinable())
+            thread.join();
+    }
+    Threads.clear();
+}
+
+bool ThreadIoBackend::Submit(IoOperation* const operation)
+{
+    {
+        std::unique_lock<std::mutex> lock(RequestsAccess);
+        Requests.push_back(operation);
+    }
+    RequestsCondition.notify_one();
+    return true;
+}
+
+size_t ThreadIoBackend::Poll(IoCompletion* const completions, const size_t maxCount)
+{
+    std::unique_lock<std::mutex> lock(CompletionsAccess);
+
+    const size_t count = std::min(Completions.size(), maxCount);
+    std::copy_n(Completions.begin(), count, completions);
+    Completions.erase(Completions.begin(), Completions.begin() + count);
+    CompletionsCount.store(Completions.size(), std::memory_order_relaxed);
+
+    return count;
+}
+
+bool ThreadIoBackend::HasCompletions() const
+{
+    return CompletionsCount.load(std::memory_order_acquire) != 0;
+}
+
+void ThreadIoBackend::Wait()
+{
+    std::unique_lock<std::mutex> lock(CompletionsAccess);
+    CompletionsCondition.wait(lock, [this]()
+    {
+        return !Completions.empty() || IsWakeRequested;
+    });
+    IsWakeRequested = false;
+}
+
+void ThreadIoBackend::Wake()
+{
+    {
+        std::unique_lock<std::mutex> lock(CompletionsAccess);
+        IsWakeRequested = true;
+    }
+    CompletionsCondition.notify_all();
+}
+
+void ThreadIoBackend::UpdateFile(const size_t, const int)
+{
+    // Операция содержит дескриптор файла, регистрировать его не нужно.
+}
+
+void ThreadIoBackend::OnRunningThread()
+{
+    while (true)
+    {
+        IoOperation* operation = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(RequestsAccess);
+            RequestsCondition.wait(lock, [this]()
+            {
+                return IsTerminating || !Requests.empty();
+            });
+
+            if (Requests.empty())
+                return;
+
+            operation = Requests.front();
+            Requests.pop_front();
+        }
+
+        const int64_t result = Execute(operation);
+
+        {
+            std::unique_lock<std::mutex> lock(CompletionsAccess);
+            Completions.push_back({ operation, result });
+            CompletionsCount.store(Completions.size(), std::memory_order_release);
+        }
+        CompletionsCondition.notify_all();
+    }
+}
+
+int64_t ThreadIoBackend::Execute(IoOperation* const operation)
+{
+    const bool isRead = operation->Code == IoOperation::OpCode::Read;
+
+#ifdef _WIN32
+    // Смещение в OVERLAPPED не изменяет общую позицию файла, как и pread() / pwrite().
+    const HANDLE file = reinterpret_cast<HANDLE>(_get_osfhandle(operation->FileFd));
+
+    OVERLAPPED overlapped = {};
+    overlapped.Offset     = static_cast<DWORD>(operation->Offset);
+    overlapped.OffsetHigh = static_cast<DWORD>(static_cast<uint64_t>(operation->Offset) >> 32);
+
+    // Размер не больше AsyncFileIo::MaxIoSize и помещается в DWORD.
+    DWORD     doneSize = 0;
+    const BOOL isDone  = isRead ?
+        ReadFile(file, operation->Data, static_cast<DWORD>(operation->Size), &doneSize, &overlapped) :
+        WriteFile(file, operation->Data, static_cast<DWORD>(operation->Size), &doneSize, &overlapped);
+
+    if (isDone)
+        return doneSize;
+
+    // Чтение за концом файла, как и pread(), возвращает 0 байт.
+    if (GetLastError() == ERROR_HANDLE_EOF)
+        return 0;
+    return -EIO;
+#else
+    const ssize_t result = isRead ?
+        pread(operation->FileFd, operation->Data, operation->Size, operation->Offset) :
+        pwrite(operation->FileFd, operation->Data, operation->Size, operation->Offset);
+
+    return result < 0 ? -errno : result;
+#endif
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+AsyncFileIo::AsyncFileIo(ThreadPoolBase& pool, const AsyncIoSettings& settings) :
+    Pool(pool),
+    Files(settings.MaxFilesCount, -1)
+{
+    const size_t bufferSize = (settings.BufferSize + IoPageSize - 1) / IoPageSize * IoPageSize;
+
+    if (settings.BuffersCount > 0)
+    {
+        BuffersMemory = static_cast<char*>(AllocateBuffersMemory(settings.BuffersCount * bufferSize));
+        if (BuffersMemory == nullptr)
+            throw std::bad_alloc();
+    }
+
+    Buffers.resize(settings.BuffersCount);
+    for (size_t st = 0; st < settings.BuffersCount; st++)
+        Buffers[st] = { BuffersMemory + st * bufferSize, bufferSize, static_cast<uint32_t>(st) };
+
+    // Буферы выдаются с начала списка.
+    for (size_t st = settings.BuffersCount; st > 0; st--)
+        FreeBuffers.push_back(&Buffers[st - 1]);
+
+#ifdef THREAD_POOL_IO_URING
+    if (settings.Backend != AsyncIoBackendType::Threads)
+        Backend = UringIoBackend::Create(settings.QueueDepth, Buffers, settings.MaxFilesCount);
+#endif
+
+    UsesIoUring = Backend != nullptr;
+
+    if (!UsesIoUring)
+    {
+        THREAD_POOL_ASSERT("io_uring is not supported by the system",
+                           settings.Backend != AsyncIoBackendType::IoUring);
+
+        Backend = std::make_unique<ThreadIoBackend>(settings.FallbackThreadsCount);
+    }
+
+    THREAD_POOL_PRINTF("AsyncFileIo: using %s\n", UsesIoUring ? "io_uring" : "I/O threads");
+}
+
+AsyncFileIo::~AsyncFileIo()
+{
+    // Ядро пишет в буферы до завершения операции, поэтому дожидаемся всех операций.
+    IoCompletion completions[CompletionsBatchSize];
+    while (PendingCount.load(std::memory_order_acquire) != 0)
+    {
+        const size_t count = Backend->Poll(completions, CompletionsBatchSize);
+        if (count == 0)
+        {
+            Backend->Wait();
+            continue;
+        }
+
+        for (size_t st = 0; st < count; st++)
+        {
+            if (completions[st].Operation == nullptr)
+                continue;
+
+            delete completions[st].Operation;
+            PendingCount.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    Backend.reset();
+    FreeBuffersMemory(BuffersMemory);
+}
+
+size_t AsyncFileIo::RegisterFile(const int fd)
+{
+    std::unique_lock<std::mutex> lock(RegistryAccess);
+
+    auto fileIter = std::find(Files.begin(), Files.end(), -1);
+    THREAD_POOL_ASSERT("Registered files table is full", fileIter != Files.end());
+
+    const size_t fileIndex = static_cast<size_t>(fileIter - Files.begin());
+    Backend->UpdateFile(fileIndex, fd);
+    *fileIter = fd;
+
+    return fileIndex;
+}
+
+void AsyncFileIo::UnregisterFile(const size_t fileIndex)
+{
+    std::unique_lock<std::mutex> lock(RegistryAccess);
+
+    THREAD_POOL_ASSERT("Attempt to unregister not registered file",
+                       fileIndex < Files.size() && Files[fileIndex] != -1);
+
+    Backend->UpdateFile(fileIndex, -1);
+    Files[fileIndex] = -1;
+}
+
+IoBuffer* AsyncFileIo::TryAcquireBuffer()
+{
+    std::unique_lock<std::mutex> lock(RegistryAccess);
+
+    if (FreeBuffers.empty())
+        return nullptr;
+
+    IoBuffer* const buffer = FreeBuffers.back();
+    FreeBuffers.pop_back();
+    return buffer;
+}
+
+void AsyncFileIo::ReleaseBuffer(IoBuffer* const buffer)
+{
+    std::unique_lock<std::mutex> lock(RegistryAccess);
+    FreeBuffers.push_back(buffer);
+}
+
+bool AsyncFileIo::IsUsingIoUring() const
+{
+    return UsesIoUring;
+}
+
+size_t AsyncFileIo::GetPendingOperationsCount() const
+{
+    return PendingCount.load(std::memory_order_relaxed);
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+void AsyncFileIo::SubmitOperation(IoOperation* const operation)
+{
+    {
+        std::unique_lock<std::mutex> lock(RegistryAccess);
+
+        THREAD_POOL_ASSERT("Attempt to use not registered file",
+                           operation->FileIndex < Files.size() && Files[operation->FileIndex] != -1);
+        operation->FileFd = Files[operation->FileIndex];
+    }
+
+    THREAD_POOL_PRINTF("AsyncFileIo: submitting %s of %zd bytes\n",
+                       operation->Code == IoOperation::OpCode::Read ? "read" : "write", operation->Size);
+
+    // Операция учитывается до отправки, так как продолжение может быть выполнено сразу.
+    Pool.OnTaskAdded();
+    PendingCount.fetch_add(1);
+
+    while (!Backend->Submit(operation))
+    {
+        // Ядро примет операцию, когда будут забраны завершённые. Поток ThreadPool забирает их
+        // сам: он может быть единственным потоком, который это делает. Другие потоки будят
+        // поток ThreadPool и уступают ему процессор.
+        ThreadHandler* const handler = ThreadHandler::GetCurrent();
+        if (handler != nullptr && &handler->GetHolder() == &Pool)
+            PollCompletions(*handler);
+        else
+        {
+            Pool.OnAsyncIoSubmitted();
+            std::this_thread::yield();
+        }
+    }
+
+    Pool.OnAsyncIoSubmitted();
+}
+
+size_t AsyncFileIo::PollCompletions(ThreadHandler& handler)
+{
+    // Очередь завершения разбирается и без отправленных операций: в ней могут остаться
+    // пробуждения WakeWaiter(), которые иначе копились бы до её переполнения.
+    if (!Backend->HasCompletions())
+        return 0;
+
+    IoCompletion completions[CompletionsBatchSize];
+    const size_t count = Backend->Poll(completions, CompletionsBatchSize);
+
+    size_t doneCount = 0;
+    for (size_t st = 0; st < count; st++)
+    {
+        IoOperation* const operation = completions[st].Operation;
+        if (operation == nullptr)
+            continue;
+
+        THREAD_POOL_PRINTF("Thread #%zd is resuming I/O continuation\n", handler.GetIndex());
+        try
+        {
+            operation->Complete(completions[st].Result);
+        }
+        catch (...)
+        {
+            // Как и исключение не ожидаемого задания, исключение продолжения передать некому.
+            // Остальные забранные операции должны быть выполнены и учтены.
+            THREAD_POOL_PRINTF("Thread #%zd: I/O continuation threw an exception\n", handler.GetIndex());
+        }
+        delete operation;
+
+        handler.IncDoneTasksCount();
+        PendingCount.fetch_sub(1, std::memory_order_relaxed);
+        Pool.OnTaskFinished();
+        doneCount++;
+    }
+
+    return doneCount;
+}
+
+void AsyncFileIo::WaitCompletions()
+{
+    Backend->Wait();
+}
+
+void AsyncFileIo::WakeWaiter()
+{
+    Backend->Wake();
+}
+
+bool AsyncFileIo::HasPendingOperations() const
+{
+    return PendingCount.load() != 0;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+static void* AllocateBuffersMemory(const size_t size)
+{
+#ifdef _WIN32
+    return _aligned_malloc(size, IoPageSize);
+#else
+    return std::aligned_alloc(IoPageSize, size);
+#endif
+}
+
+static void FreeBuffersMemory(void* const memory)
+{
+#ifdef _WIN32
+    _aligned_free(memory);
+#else
+    std::free(memory);
+#endif
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
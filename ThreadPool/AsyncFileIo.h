@@ -0,0 +1,268 @@
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+// Модуль ThreadPool, асинхронный файловый ввод-вывод.
+//
+// Версия: 1.0.0.0
+// Дата последнего изменения: 19.10.2026
+//
+// Автор: Маслов А.С. (https://github.com/ArtemMaslov).
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "ThreadPoolPolicies.h"
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+namespace ThreadPoolModule
+{
+    class ThreadHandler;
+    class ThreadPoolBase;
+    class IoBackend;
+
+    /**
+     * @brief Способ выполнения операций ввода-вывода.
+    */
+    enum class AsyncIoBackendType
+    {
+        /// io_uring, если он поддерживается (Linux 5.6 и новее), иначе потоки ввода-вывода.
+        Auto,
+        /// Только io_uring. Если он не поддерживается, то EnableAsyncIo() завершит программу.
+        IoUring,
+        /// Блокирующие pread() / pwrite() в отдельных потоках ввода-вывода.
+        Threads
+    };
+
+    /**
+     * @brief Параметры асинхронного ввода-вывода.
+    */
+    struct AsyncIoSettings
+    {
+        AsyncIoBackendType Backend              = AsyncIoBackendType::Auto;
+        /// Размер очереди отправки io_uring.
+        size_t             QueueDepth           = 256;
+        /// Количество буферов, зарегистрированных в ядре (ReadFixed, WriteFixed).
+        size_t             BuffersCount         = 64;
+        /// Размер каждого буфера в байтах. Округляется вверх до размера страницы.
+        size_t             BufferSize           = 64 * 1024;
+        /// Максимальное количество зарегистрированных файлов.
+        size_t             MaxFilesCount        = 64;
+        /// Количество потоков ввода-вывода, если io_uring недоступен.
+        size_t             FallbackThreadsCount = 4;
+    };
+
+    /**
+     * @brief Буфер, зарегистрированный в ядре. Ядро не отображает его страницы при каждой
+     * операции.
+    */
+    struct IoBuffer
+    {
+        void*    Data;
+        size_t   Size;
+        uint32_t Index;
+    };
+
+    /**
+     * @brief Операция ввода-вывода и её продолжение.
+    */
+    class IoOperation
+    {
+    public:
+        enum class OpCode
+        {
+            Read,
+            Write
+        };
+
+        virtual ~IoOperation() = default;
+
+        /**
+         * @brief Выполнить продолжение операции.
+         *
+         * @param result Количество прочитанных или записанных байт либо -errno.
+        */
+        virtual void Complete(const int64_t result) = 0;
+
+        OpCode   Code        = OpCode::Read;
+        /// Номер зарегистрированного файла.
+        size_t   FileIndex   = 0;
+        /// Дескриптор файла для потоков ввода-вывода.
+        int      FileFd      = -1;
+        uint64_t Offset      = 0;
+        void*    Data        = nullptr;
+        size_t   Size        = 0;
+        /// Номер зарегистрированного буфера или -1.
+        int64_t  BufferIndex = -1;
+    };
+
+    template <typename Continuation>
+    class CallableIoOperation : public IoOperation
+    {
+    public:
+        CallableIoOperation(Continuation&& continuation);
+
+        void Complete(const int64_t result) override;
+
+    private:
+        Continuation Funct;
+    };
+
+    ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+    ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+    /**
+     * @brief Асинхронный файловый ввод-вывод, встроенный в потоки ThreadPool.
+     *
+     * Операции отправляются через io_uring с зарегистрированными буферами и файлами. Поток
+     * ThreadPool не блокируется на время операции: завершённые операции забирают потоки
+     * ThreadPool между заданиями, а простаивающий поток ожидает их вместо засыпания. Продолжение
+     * операции выполняется забравшим её потоком. Незавершённые операции учитываются в WaitAll().
+     *
+     * Если io_uring недоступен, операции выполняют отдельные потоки ввода-вывода.
+     *
+     * Создаётся вызовом ThreadPoolBase::EnableAsyncIo() и уничтожается вместе с ThreadPool.
+    */
+    class AsyncFileIo
+    {
+    public:
+        /// Максимальный размер одной операции. Больше Linux не читает и не пишет за один вызов,
+        /// а длина элемента io_uring 32-битная.
+        static constexpr size_t MaxIoSize = 0x7ffff000;
+
+        AsyncFileIo(ThreadPoolBase& pool, const AsyncIoSettings& settings);
+
+        AsyncFileIo(const AsyncFileIo&)            = delete;
+        AsyncFileIo& operator=(const AsyncFileIo&) = delete;
+
+        /**
+         * @brief Дожидается незавершённых операций, их продолжения не выполняются.
+        */
+        ~AsyncFileIo();
+
+        /**
+         * @brief Зарегистрировать открытый файл.
+         *
+         * @return Номер файла, который передаётся в операции.
+        */
+        size_t RegisterFile(const int fd);
+
+        /**
+         * @brief Отменить регистрацию файла. Операций с файлом не должно быть в процессе выполнения.
+        */
+        void UnregisterFile(const size_t fileIndex);
+
+        /**
+         * @brief Взять свободный зарегистрированный буфер.
+         *
+         * @return Буфер или nullptr, если все буферы заняты.
+        */
+        IoBuffer* TryAcquireBuffer();
+
+        /**
+         * @brief Вернуть буфер.
+        */
+        void ReleaseBuffer(IoBuffer* const buffer);
+
+        /**
+         * @brief Прочитать size байт в зарегистрированный буфер.
+         *
+         * @param continuation Вызывается как continuation(int64_t result) потоком ThreadPool,
+         * result - количество прочитанных байт либо -errno. Исключение, выброшенное
+         * продолжением, отбрасывается.
+        */
+        template <typename Continuation>
+        void ReadFixed(const size_t fileIndex, const uint64_t offset, IoBuffer* const buffer,
+                       const size_t size, Continuation continuation);
+
+        /**
+         * @brief Записать size байт из зарегистрированного буфера.
+        */
+        template <typename Continuation>
+        void WriteFixed(const size_t fileIndex, const uint64_t offset, IoBuffer* const buffer,
+                        const size_t size, Continuation continuation);
+
+        /**
+         * @brief Прочитать size байт в память пользователя. size не больше MaxIoSize.
+        */
+        template <typename Continuation>
+        void Read(const size_t fileIndex, const uint64_t offset, void* const data,
+                  const size_t size, Continuation continuation);
+
+        /**
+         * @brief Записать size байт из памяти пользователя. size не больше MaxIoSize.
+        */
+        template <typename Continuation>
+        void Write(const size_t fileIndex, const uint64_t offset, const void* const data,
+                   const size_t size, Continuation continuation);
+
+        /**
+         * @brief Проверить, используется ли io_uring.
+        */
+        bool IsUsingIoUring() const;
+
+        /**
+         * @brief Получить количество операций, продолжения которых ещё не выполнены.
+        */
+        size_t GetPendingOperationsCount() const;
+
+    private:
+        friend class ThreadPoolBase;
+
+        template <typename Continuation>
+        void Submit(const IoOperation::OpCode code, const size_t fileIndex, const uint64_t offset,
+                    void* const data, const size_t size, const int64_t bufferIndex,
+                    Continuation&& continuation);
+
+        /**
+         * @brief Отправить операцию и учесть её в ThreadPool.
+        */
+        void SubmitOperation(IoOperation* const operation);
+
+        /**
+         * @brief Выполнить продолжения завершённых операций. Не блокирует поток. Исключение
+         * продолжения отбрасывается.
+         *
+         * @return Количество выполненных продолжений.
+        */
+        size_t PollCompletions(ThreadHandler& handler);
+
+        /**
+         * @brief Ожидать завершения операции или вызова WakeWaiter().
+        */
+        void WaitCompletions();
+
+        /**
+         * @brief Прервать WaitCompletions(). Если ожидания нет, то следующее ожидание
+         * завершится сразу.
+        */
+        void WakeWaiter();
+
+        bool HasPendingOperations() const;
+
+        ThreadPoolBase&            Pool;
+        std::unique_ptr<IoBackend> Backend;
+        bool                       UsesIoUring = false;
+
+        /// Количество отправленных операций, продолжения которых ещё не выполнены.
+        alignas(CacheLineSize) std::atomic<size_t> PendingCount = 0;
+
+        /// Контроль над доступом к таблице файлов и списку свободных буферов.
+        std::mutex             RegistryAccess;
+        /// Дескрипторы зарегистрированных файлов, -1 - свободная ячейка.
+        std::vector<int>       Files;
+        /// Память всех буферов, выровнена по размеру страницы.
+        char*                  BuffersMemory = nullptr;
+        std::vector<IoBuffer>  Buffers;
+        std::vector<IoBuffer*> FreeBuffers;
+    };
+};
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
@@ -0,0 +1,93 @@
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+// Модуль ThreadPool, шаблонные методы асинхронного ввода-вывода.
+//
+// Версия: 1.0.0.0
+// Дата последнего изменения: 19.10.2026
+//
+// Автор: Маслов А.С. (https://github.com/ArtemMaslov).
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+#include <utility>
+
+#include "ThreadPool.h"
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+namespace ThreadPoolModule
+{
+    template <typename Continuation>
+    void AsyncFileIo::ReadFixed(const size_t fileIndex, const uint64_t offset, IoBuffer* const buffer,
+                                const size_t size, Continuation continuation)
+    {
+        THREAD_POOL_ASSERT("I/O size exceeds buffer size", size <= buffer->Size);
+
+        Submit(IoOperation::OpCode::Read, fileIndex, offset, buffer->Data, size, buffer->Index,
+               std::move(continuation));
+    }
+
+    template <typename Continuation>
+    void AsyncFileIo::WriteFixed(const size_t fileIndex, const uint64_t offset, IoBuffer* const buffer,
+                                 const size_t size, Continuation continuation)
+    {
+        THREAD_POOL_ASSERT("I/O size exceeds buffer size", size <= buffer->Size);
+
+        Submit(IoOperation::OpCode::Write, fileIndex, offset, buffer->Data, size, buffer->Index,
+               std::move(continuation));
+    }
+
+    template <typename Continuation>
+    void AsyncFileIo::Read(const size_t fileIndex, const uint64_t offset, void* const data,
+                           const size_t size, Continuation continuation)
+    {
+        Submit(IoOperation::OpCode::Read, fileIndex, offset, data, size, -1,
+               std::move(continuation));
+    }
+
+    template <typename Continuation>
+    void AsyncFileIo::Write(const size_t fileIndex, const uint64_t offset, const void* const data,
+                            const size_t size, Continuation continuation)
+    {
+        Submit(IoOperation::OpCode::Write, fileIndex, offset, const_cast<void*>(data), size, -1,
+               std::move(continuation));
+    }
+
+    template <typename Continuation>
+    void AsyncFileIo::Submit(const IoOperation::OpCode code, const size_t fileIndex,
+                             const uint64_t offset, void* const data, const size_t size,
+                             const int64_t bufferIndex, Continuation&& continuation)
+    {
+        THREAD_POOL_ASSERT("I/O size exceeds AsyncFileIo::MaxIoSize", size <= MaxIoSize);
+
+        IoOperation* const operation =
+            new CallableIoOperation<Continuation>(std::move(continuation));
+
+        operation->Code        = code;
+        operation->FileIndex   = fileIndex;
+        operation->Offset      = offset;
+        operation->Data        = data;
+        operation->Size        = size;
+        operation->BufferIndex = bufferIndex;
+
+        SubmitOperation(operation);
+    }
+
+    ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+    ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+    template <typename Continuation>
+    CallableIoOperation<Continuation>::CallableIoOperation(Continuation&& continuation) :
+        IoOperation(),
+        Funct(std::move(continuation))
+    {
+    }
+
+    template <typename Continuation>
+    void CallableIoOperation<Continuation>::Complete(const int64_t result)
+    {
+        Funct(result);
+    }
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
@@ -0,0 +1,257 @@
+#include <iostream>
+#include <chrono>
+#include <atomic>
+#include <vector>
+#include <deque>
+#include <mutex>
+
+#include "ThreadPool.h"
+#include "Strand.h"
+
+using ThreadPoolModule::BasicThreadPool;
+using ThreadPoolModule::ThreadPool;
+using ThreadPoolModule::FireAndForgetThreadPool;
+using ThreadPoolModule::Strand;
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+/// Lock-free очередь, но задания создаются оператором new.
+typedef BasicThreadPool<ThreadPoolModule::LockFreeQueuePolicy<>,
+                        ThreadPoolModule::NoTaskWaitPolicy,
+                        ThreadPoolModule::DiscardResultPolicy,
+                        ThreadPoolModule::HeapAllocPolicy>    LockFreeHeapThreadPool;
+
+/// Очередь с мьютексом без таблицы результатов.
+typedef BasicThreadPool<ThreadPoolModule::MutexQueuePolicy,
+                        ThreadPoolModule::NoTaskWaitPolicy,
+                        ThreadPoolModule::DiscardResultPolicy,
+                        ThreadPoolModule::HeapAllocPolicy>    MutexDiscardThreadPool;
+
+template <typename PoolType>
+static void BenchFireAndForget(const char* const name, const size_t threadsCount,
+                               const size_t tasksCount);
+
+static void BenchWaitable(const char* const name, const size_t threadsCount,
+                          const size_t tasksCount);
+
+static void BenchKeyedMutex(const char* const name, const size_t threadsCount,
+                            const size_t tasksCount);
+
+static void BenchKeyedStrand(const char* const name, const size_t threadsCount,
+                             const size_t tasksCount);
+
+static void BenchFibers(const char* const name, const size_t threadsCount,
+                        const size_t tasksCount);
+
+static void BenchForkJoinFibers(const char* const name, const size_t threadsCount,
+                                const size_t tasksCount);
+
+static void PrintResult(const char* const name, const size_t tasksCount,
+                        const std::chrono::steady_clock::duration duration);
+
+static void TinyTask(const size_t value);
+
+/// Данные, общие для заданий с одним ключом.
+struct KeyState
+{
+    std::mutex Access;
+    size_t     Value = 0;
+};
+
+static void KeyedTask(KeyState* const state, const size_t value);
+
+static size_t ForkJoinTask(ThreadPool* const threadPool, const size_t tasksCount);
+
+static std::atomic<size_t> TinyTasksSum = 0;
+
+static const size_t BenchThreadsCount = 4;
+static const size_t BenchTasksCount   = 200'000;
+static const size_t BenchRepeatsCount = 3;
+static const size_t BenchKeysCount    = 8;
+/// Задания fork-join выполняются в порядке очереди, поэтому почти половина из них одновременно
+/// ожидает дочерние в приостановленных волокнах. Каждое волокно занимает два отображения
+/// памяти, а их количество в Linux ограничено vm.max_map_count (по умолчанию 65530).
+static const size_t BenchForkJoinTasksCount = 20'000;
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+int main()
+{
+    printf("threads = %zd, tasks = %zd\n", BenchThreadsCount, BenchTasksCount);
+    printf("%-40s %12s %14s\n", "configuration", "time, ms", "tasks/s");
+
+    for (size_t st = 0; st < BenchRepeatsCount; st++)
+    {
+        BenchWaitable("ThreadPool, waitable tasks", BenchThreadsCount, BenchTasksCount);
+        BenchFireAndForget<ThreadPool>("ThreadPool", BenchThreadsCount, BenchTasksCount);
+        BenchFireAndForget<MutexDiscardThreadPool>("Mutex queue, no results",
+                                                   BenchThreadsCount, BenchTasksCount);
+        BenchFireAndForget<LockFreeHeapThreadPool>("Lock-free queue, heap alloc",
+                                                   BenchThreadsCount, BenchTasksCount);
+        BenchFireAndForget<FireAndForgetThreadPool>("FireAndForgetThreadPool",
+                                                    BenchThreadsCount, BenchTasksCount);
+        BenchKeyedMutex("Keyed state, mutex in task", BenchThreadsCount, BenchTasksCount);
+        BenchKeyedStrand("Keyed state, strand per key", BenchThreadsCount, BenchTasksCount);
+        BenchFibers("ThreadPool, fibers", BenchThreadsCount, BenchTasksCount);
+        BenchForkJoinFibers("Fork-join with Wait, fibers", BenchThreadsCount, BenchForkJoinTasksCount);
+    }
+
+    return 0;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+template <typename PoolType>
+static void BenchFireAndForget(const char* const name, const size_t threadsCount,
+                               const size_t tasksCount)
+{
+    PoolType threadPool(threadsCount);
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (size_t st = 0; st < tasksCount; st++)
+        threadPool.Post(TinyTask, st);
+
+    threadPool.WaitAll();
+
+    PrintResult(name, tasksCount, std::chrono::steady_clock::now() - start);
+}
+
+static void BenchWaitable(const char* const name, const size_t threadsCount,
+                          const size_t tasksCount)
+{
+    ThreadPool threadPool(threadsCount);
+    std::vector<ThreadPoolModule::TaskId> tasksIds(tasksCount);
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (size_t st = 0; st < tasksCount; st++)
+        tasksIds[st] = threadPool.AddTask(true, TinyTask, st);
+
+    threadPool.WaitAll();
+
+    for (ThreadPoolModule::TaskId taskId: tasksIds)
+        threadPool.GetTaskResult<void>(taskId);
+
+    PrintResult(name, tasksCount, std::chrono::steady_clock::now() - start);
+}
+
+static void BenchKeyedMutex(const char* const name, const size_t threadsCount,
+                            const size_t tasksCount)
+{
+    ThreadPool threadPool(threadsCount);
+    std::deque<KeyState> states(BenchKeysCount);
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (size_t st = 0; st < tasksCount; st++)
+    {
+        KeyState* const state = &states[st % BenchKeysCount];
+        threadPool.AddTask(false, [state, st]()
+        {
+            std::unique_lock<std::mutex> lock(state->Access);
+            KeyedTask(state, st);
+        });
+    }
+
+    threadPool.WaitAll();
+
+    PrintResult(name, tasksCount, std::chrono::steady_clock::now() - start);
+}
+
+static void BenchKeyedStrand(const char* const name, const size_t threadsCount,
+                             const size_t tasksCount)
+{
+    ThreadPool threadPool(threadsCount);
+    std::deque<KeyState> states(BenchKeysCount);
+    std::deque<Strand>   strands;
+    for (size_t st = 0; st < BenchKeysCount; st++)
+        strands.emplace_back(threadPool);
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (size_t st = 0; st < tasksCount; st++)
+        strands[st % BenchKeysCount].Post(KeyedTask, &states[st % BenchKeysCount], st);
+
+    threadPool.WaitAll();
+
+    PrintResult(name, tasksCount, std::chrono::steady_clock::now() - start);
+}
+
+static void BenchFibers(const char* const name, const size_t threadsCount,
+                        const size_t tasksCount)
+{
+    ThreadPool threadPool(threadsCount);
+    threadPool.EnableFibers();
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (size_t st = 0; st < tasksCount; st++)
+        threadPool.AddTask(false, TinyTask, st);
+
+    threadPool.WaitAll();
+
+    PrintResult(name, tasksCount, std::chrono::steady_clock::now() - start);
+}
+
+static void BenchForkJoinFibers(const char* const name, const size_t threadsCount,
+                                const size_t tasksCount)
+{
+    ThreadPool threadPool(threadsCount);
+    threadPool.EnableFibers();
+
+    const auto start = std::chrono::steady_clock::now();
+
+    // Каждое задание, кроме листьев, ожидает два дочерних. Без волокон ожидающие задания
+    // заняли бы все потоки.
+    const ThreadPoolModule::TaskId rootId = threadPool.AddTask(true, ForkJoinTask, &threadPool, tasksCount);
+    threadPool.Wait(rootId);
+    const size_t doneCount = threadPool.GetTaskResult<size_t>(rootId);
+
+    PrintResult(name, doneCount, std::chrono::steady_clock::now() - start);
+}
+
+static void PrintResult(const char* const name, const size_t tasksCount,
+                        const std::chrono::steady_clock::duration duration)
+{
+    const double milliseconds = std::chrono::duration<double, std::milli>(duration).count();
+    printf("%-40s %12.2lf %14.0lf\n", name, milliseconds, tasksCount * 1000.0 / milliseconds);
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+static void TinyTask(const size_t value)
+{
+    TinyTasksSum.fetch_add(value, std::memory_order_relaxed);
+}
+
+static void KeyedTask(KeyState* const state, const size_t value)
+{
+    // Небольшая работа с общими данными ключа.
+    for (size_t st = 0; st < 64; st++)
+        state->Value = state->Value * 31 + value + st;
+}
+
+static size_t ForkJoinTask(ThreadPool* const threadPool, const size_t tasksCount)
+{
+    if (tasksCount < 3)
+        return 1;
+
+    // Задание и два поддерева, в каждом примерно половина оставшихся заданий.
+    const size_t childTasksCount = (tasksCount - 1) / 2;
+
+    const ThreadPoolModule::TaskId leftId  = threadPool->AddTask(true, ForkJoinTask, threadPool, childTasksCount);
+    const ThreadPoolModule::TaskId rightId = threadPool->AddTask(true, ForkJoinTask, threadPool, childTasksCount);
+
+    threadPool->Wait(leftId);
+    threadPool->Wait(rightId);
+
+    return 1 + threadPool->GetTaskResult<size_t>(leftId) + threadPool->GetTaskResult<size_t>(rightId);
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
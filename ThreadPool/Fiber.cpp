@@ -0,0 +1,649 @@
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+// Модуль ThreadPool, выполнение заданий в волокнах (fibers).
+//
+// Версия: 1.0.0.0
+// Дата последнего изменения: 19.10.2026
+//
+// Автор: Маслов А.С. (https://github.com/ArtemMaslov).
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+// Волокнам нужны стеки с защитной страницей (mmap) и переключение контекста, поэтому они
+// поддерживаются только в POSIX-системах. На остальных FiberRuntime завершает программу.
+#if defined(__unix__) || defined(__APPLE__)
+    #define THREAD_POOL_FIBERS_SUPPORTED
+#endif
+
+// Переключение контекста написано для x86-64 по System V ABI. На других архитектурах
+// используется ucontext, который дополнительно сохраняет маску сигналов системным вызовом.
+#if defined(THREAD_POOL_FIBERS_SUPPORTED) && !(defined(__x86_64__) && defined(__ELF__)) && \
+    !defined(THREAD_POOL_FIBER_UCONTEXT)
+    #define THREAD_POOL_FIBER_UCONTEXT
+#endif
+
+// В macOS ucontext доступен, только если объявлен _XOPEN_SOURCE до системных заголовков.
+#if defined(THREAD_POOL_FIBER_UCONTEXT) && defined(__APPLE__) && !defined(_XOPEN_SOURCE)
+    #define _XOPEN_SOURCE 700
+#endif
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+
+#ifdef THREAD_POOL_FIBERS_SUPPORTED
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+#include "ThreadPool.h"
+
+#ifdef THREAD_POOL_FIBER_UCONTEXT
+    #include <ucontext.h>
+#endif
+
+// Санитайзеры должны знать о переключении стеков, иначе сообщают о ложных ошибках.
+#if defined(__SANITIZE_ADDRESS__)
+    #define THREAD_POOL_FIBER_ASAN
+#endif
+#if defined(__SANITIZE_THREAD__)
+    #define THREAD_POOL_FIBER_TSAN
+#endif
+#if defined(__has_feature)
+    #if __has_feature(address_sanitizer)
+        #define THREAD_POOL_FIBER_ASAN
+    #endif
+    #if __has_feature(thread_sanitizer)
+        #define THREAD_POOL_FIBER_TSAN
+    #endif
+#endif
+
+#ifdef THREAD_POOL_FIBER_ASAN
+    #include <sanitizer/asan_interface.h>
+#endif
+#ifdef THREAD_POOL_FIBER_TSAN
+    #include <sanitizer/tsan_interface.h>
+#endif
+
+using namespace ThreadPoolModule;
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+/// Размер страницы памяти. Стек и защитная страница выравниваются по нему.
+#ifdef THREAD_POOL_FIBERS_SUPPORTED
+static const size_t FiberPageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#else
+static const size_t FiberPageSize = 4096;
+#endif
+
+namespace ThreadPoolModule
+{
+    /**
+     * @brief Сохранённое состояние волокна или цикла потока ThreadPool.
+    */
+    struct FiberContext
+    {
+#ifdef THREAD_POOL_FIBER_UCONTEXT
+        ucontext_t  Context;
+#else
+        /// Вершина стека, на которой сохранены регистры.
+        void*       StackPointer   = nullptr;
+#endif
+        /// Нижняя граница и размер стека для AddressSanitizer. Для цикла потока становятся
+        /// известны при первом переключении в волокно.
+        const void* StackBottom    = nullptr;
+        size_t      StackSize      = 0;
+        void*       FakeStack      = nullptr;
+        /// Волокно ThreadSanitizer.
+        void*       SanitizerFiber = nullptr;
+    };
+
+    /**
+     * @brief Волокно: стек и сохранённое состояние. Переиспользуется для следующих заданий.
+    */
+    class Fiber
+    {
+    public:
+        enum class FiberState
+        {
+            /// Выполняет задание.
+            Running,
+            /// Ожидает вызова FiberRuntime::Resume().
+            Suspended,
+            /// Выполнило задание и может быть переиспользовано.
+            Finished
+        };
+
+        Fiber(FiberRuntime& runtime, FiberWorker& worker);
+
+        FiberContext  Context;
+        FiberRuntime& Runtime;
+        /// Волокно всегда продолжается потоком, который его создал.
+        FiberWorker&  Worker;
+
+        /// Стек вместе с защитной страницей.
+        char*         Memory     = nullptr;
+        size_t        MemorySize = 0;
+
+        TaskBase*     Task       = nullptr;
+        FiberState    State      = FiberState::Finished;
+
+        /// Соседи в списке приостановленных волокон потока.
+        Fiber*        PrevSuspended = nullptr;
+        Fiber*        NextSuspended = nullptr;
+    };
+
+    /**
+     * @brief Волокна одного потока ThreadPool.
+     *
+     * Списки свободных и приостановленных волокон изменяются только потоком-владельцем.
+     * Очередь готовых волокон пополняется любыми потоками в FiberRuntime::Resume().
+    */
+    class FiberWorker
+    {
+    public:
+        void PushReady(Fiber* const fiber);
+
+        Fiber* TryPopReady();
+
+        bool HasReady() const;
+
+        void LinkSuspended(Fiber* const fiber);
+
+        void UnlinkSuspended(Fiber* const fiber);
+
+        ThreadHandler*      Handler = nullptr;
+        /// Состояние цикла потока, в который возвращается волокно.
+        FiberContext        SchedulerContext;
+        std::vector<Fiber*> FreeFibers;
+        Fiber*              SuspendedFibers = nullptr;
+
+        /// Контроль над доступом к очереди готовых волокон.
+        std::mutex          ReadyAccess;
+        std::deque<Fiber*>  ReadyFibers;
+        /// Количество готовых волокон. Позволяет проверять очередь без захвата мьютекса.
+        alignas(CacheLineSize) std::atomic<size_t> ReadyCount = 0;
+    };
+}
+
+/// Волокно, выполняемое текущим потоком.
+static thread_local Fiber* CurrentFiber = nullptr;
+
+static void PrepareContext(FiberContext& context, char* const stackBottom, const size_t stackSize,
+                           void (*entry)(void*), void* const arg);
+
+static void SwitchContext(FiberContext& from, FiberContext& to);
+
+/**
+ * @brief Выделить стек волокна. Под стеком находится защитная страница.
+ *
+ * @param memorySize Размер стека вместе с защитной страницей.
+*/
+static char* AllocateStack(const size_t memorySize);
+
+static void FreeStack(char* const memory, const size_t memorySize);
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+//                               Переключение контекста
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+#if !defined(THREAD_POOL_FIBERS_SUPPORTED)
+
+// Волокна не создаются: конструктор FiberRuntime завершает программу.
+static void PrepareContext(FiberContext&, char* const, const size_t, void (*)(void*), void* const)
+{
+}
+
+static void SwitchRawContext(FiberContext&, FiberContext&)
+{
+}
+
+#elif !defined(THREAD_POOL_FIBER_UCONTEXT)
+
+extern "C" void ThreadPoolSwitchFiberContext(void** const saveStackPointer, void* const loadStackPointer);
+extern "C" void ThreadPoolFiberTrampoline();
+
+// Сохраняются только регистры, которые функция обязана сохранять по System V ABI, и управляющие
+// слова x87 и SSE. Остальные регистры сохраняет вызывающий код.
+asm(R"(
+    .text
+    .globl   ThreadPoolSwitchFiberContext
+    .hidden  ThreadPoolSwitchFiberContext
+    .type    ThreadPoolSwitchFiberContext, @function
+    .p2align 4
+ThreadPoolSwitchFiberContext:
+    pushq    %rbp
+    pushq    %rbx
+    pushq    %r12
+    pushq    %r13
+    pushq    %r14
+    pushq    %r15
+    subq     $16, %rsp
+    stmxcsr  8(%rsp)
+    fnstcw   (%rsp)
+    movq     %rsp, (%rdi)
+    movq     %rsi, %rsp
+    fldcw    (%rsp)
+    ldmxcsr  8(%rsp)
+    addq     $16, %rsp
+    popq     %r15
+    popq     %r14
+    popq     %r13
+    popq     %r12
+    popq     %rbx
+    popq     %rbp
+    ret
+    .size    ThreadPoolSwitchFiberContext, .-ThreadPoolSwitchFiberContext
+
+    .globl   ThreadPoolFiberTrampoline
+    .hidden  ThreadPoolFiberTrampoline
+    .type    ThreadPoolFiberTrampoline, @function
+    .p2align 4
+ThreadPoolFiberTrampoline:
+    movq     %r12, %rdi
+    callq    *%r13
+    ud2
+    .size    ThreadPoolFiberTrampoline, .-ThreadPoolFiberTrampoline
+)");
+
+/// Значения управляющих слов x87 и SSE по умолчанию.
+static const uint64_t DefaultX87ControlWord = 0x037F;
+static const uint64_t DefaultMxcsr          = 0x1F80;
+
+static void PrepareContext(FiberContext& context, char* const stackBottom, const size_t stackSize,
+                           void (*entry)(void*), void* const arg)
+{
+    // Начальный кадр повторяет сохраняемый ThreadPoolSwitchFiberContext(): управляющие слова,
+    // r15, r14, r13, r12, rbx, rbp и адрес возврата. Первое переключение "возвращается" в
+    // ThreadPoolFiberTrampoline(), который вызывает entry(arg) со стеком, выровненным по 16 байтам.
+    const uintptr_t stackTop = reinterpret_cast<uintptr_t>(stackBottom + stackSize) & ~uintptr_t(15);
+    uint64_t* const frame    = reinterpret_cast<uint64_t*>(stackTop - 11 * sizeof(uint64_t));
+
+    frame[0]  = DefaultX87ControlWord;
+    frame[1]  = DefaultMxcsr;
+    frame[2]  = 0;
+    frame[3]  = 0;
+    frame[4]  = reinterpret_cast<uint64_t>(entry);
+    frame[5]  = reinterpret_cast<uint64_t>(arg);
+    frame[6]  = 0;
+    frame[7]  = 0;
+    frame[8]  = reinterpret_cast<uint64_t>(&ThreadPoolFiberTrampoline);
+    frame[9]  = 0;
+    frame[10] = 0;
+
+    context.StackPointer = frame;
+}
+
+static void SwitchRawContext(FiberContext& from, FiberContext& to)
+{
+    ThreadPoolSwitchFiberContext(&from.StackPointer, to.StackPointer);
+}
+
+#else
+
+/**
+ * @brief Точка входа ucontext. makecontext() передаёт только аргументы типа int, поэтому
+ * указатели передаются половинами.
+*/
+static void UcontextEntry(const unsigned entryHigh, const unsigned entryLow,
+                          const unsigned argHigh,   const unsigned argLow)
+{
+    void (*entry)(void*) = reinterpret_cast<void (*)(void*)>(
+        (static_cast<uintptr_t>(entryHigh) << 32) | entryLow);
+    void* const arg = reinterpret_cast<void*>((static_cast<uintptr_t>(argHigh) << 32) | argLow);
+
+    entry(arg);
+}
+
+static void PrepareContext(FiberContext& context, char* const stackBottom, const size_t stackSize,
+                           void (*entry)(void*), void* const arg)
+{
+    getcontext(&context.Context);
+    context.Context.uc_stack.ss_sp   = stackBottom;
+    context.Context.uc_stack.ss_size = stackSize;
+    context.Context.uc_link          = nullptr;
+
+    const uint64_t entryValue = reinterpret_cast<uintptr_t>(entry);
+    const uint64_t argValue   = reinterpret_cast<uintptr_t>(arg);
+    makecontext(&context.Context, reinterpret_cast<void (*)()>(UcontextEntry), 4,
+                static_cast<unsigned>(entryValue >> 32), static_cast<unsigned>(entryValue),
+                static_cast<unsigned>(argValue >> 32),   static_cast<unsigned>(argValue));
+}
+
+static void SwitchRawContext(FiberContext& from, FiberContext& to)
+{
+    swapcontext(&from.Context, &to.Context);
+}
+
+#endif
+
+static void SwitchContext(FiberContext& from, FiberContext& to)
+{
+#ifdef THREAD_POOL_FIBER_ASAN
+    __sanitizer_start_switch_fiber(&from.FakeStack, to.StackBottom, to.StackSize);
+#endif
+#ifdef THREAD_POOL_FIBER_TSAN
+    __tsan_switch_to_fiber(to.SanitizerFiber, 0);
+#endif
+
+    SwitchRawContext(from, to);
+
+#ifdef THREAD_POOL_FIBER_ASAN
+    // Переключение происходит только между волокном и циклом потока, поэтому обратно
+    // переключается тот же контекст to. Для цикла потока так становятся известны границы стека.
+    __sanitizer_finish_switch_fiber(from.FakeStack, &to.StackBottom, &to.StackSize);
+#endif
+}
+
+static char* AllocateStack(const size_t memorySize)
+{
+#ifdef THREAD_POOL_FIBERS_SUPPORTED
+    void* const memory = mmap(nullptr, memorySize, PROT_READ | PROT_WRITE,
+                              MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK, -1, 0);
+    THREAD_POOL_ASSERT("Failed to allocate fiber stack", memory != MAP_FAILED);
+
+    // Стек растёт вниз, поэтому переполнение попадает на защитную страницу и завершает
+    // программу, а не портит соседнюю память.
+    const int protectResult = mprotect(memory, FiberPageSize, PROT_NONE);
+    THREAD_POOL_ASSERT("Failed to protect fiber stack guard page", protectResult == 0);
+
+    return static_cast<char*>(memory);
+#else
+    THREAD_POOL_ASSERT("Fibers are not supported on this platform", false);
+    return nullptr;
+#endif
+}
+
+static void FreeStack(char* const memory, const size_t memorySize)
+{
+#ifdef THREAD_POOL_FIBERS_SUPPORTED
+    munmap(memory, memorySize);
+#endif
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+Fiber::Fiber(FiberRuntime& runtime, FiberWorker& worker) :
+    Context(),
+    Runtime(runtime),
+    Worker(worker)
+{
+}
+
+void FiberWorker::PushReady(Fiber* const fiber)
+{
+    std::unique_lock<std::mutex> lock(ReadyAccess);
+    ReadyFibers.push_back(fiber);
+    // Парная проверка находится в ThreadPoolBase::ParkHandler().
+    ReadyCount.fetch_add(1);
+}
+
+Fiber* FiberWorker::TryPopReady()
+{
+    if (!HasReady())
+        return nullptr;
+
+    std::unique_lock<std::mutex> lock(ReadyAccess);
+    if (ReadyFibers.empty())
+        return nullptr;
+
+    Fiber* const fiber = ReadyFibers.front();
+    ReadyFibers.pop_front();
+    ReadyCount.fetch_sub(1, std::memory_order_relaxed);
+    return fiber;
+}
+
+bool FiberWorker::HasReady() const
+{
+    return ReadyCount.load() != 0;
+}
+
+void FiberWorker::LinkSuspended(Fiber* const fiber)
+{
+    fiber->PrevSuspended = nullptr;
+    fiber->NextSuspended = SuspendedFibers;
+    if (SuspendedFibers != nullptr)
+        SuspendedFibers->PrevSuspended = fiber;
+    SuspendedFibers = fiber;
+}
+
+void FiberWorker::UnlinkSuspended(Fiber* const fiber)
+{
+    if (fiber->PrevSuspended != nullptr)
+        fiber->PrevSuspended->NextSuspended = fiber->NextSuspended;
+    else
+        SuspendedFibers = fiber->NextSuspended;
+
+    if (fiber->NextSuspended != nullptr)
+        fiber->NextSuspended->PrevSuspended = fiber->PrevSuspended;
+
+    fiber->PrevSuspended = nullptr;
+    fiber->NextSuspended = nullptr;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+FiberRuntime::FiberRuntime(ThreadPoolBase& pool, const FiberSettings& settings) :
+    Pool(pool),
+    StackSize((settings.StackSize + FiberPageSize - 1) / FiberPageSize * FiberPageSize),
+    CachedStacksCount(settings.CachedStacksCount),
+    Workers(new FiberWorker[pool.GetThreadsCount()]),
+    WorkersCount(pool.GetThreadsCount())
+{
+#ifndef THREAD_POOL_FIBERS_SUPPORTED
+    THREAD_POOL_ASSERT("Fibers are not supported on this platform", false);
+#endif
+    THREAD_POOL_ASSERT("Fiber stack size must be positive", StackSize > 0);
+
+    for (size_t st = 0; st < WorkersCount; st++)
+        Workers[st].Handler = &pool.Handlers[st];
+}
+
+FiberRuntime::~FiberRuntime()
+{
+    for (size_t st = 0; st < WorkersCount; st++)
+    {
+        FiberWorker& worker = Workers[st];
+
+        for (Fiber* const fiber: worker.FreeFibers)
+            DestroyFiber(fiber);
+        worker.FreeFibers.clear();
+
+        // Готовые волокна также находятся в списке приостановленных.
+        while (worker.SuspendedFibers != nullptr)
+        {
+            Fiber* const fiber = worker.SuspendedFibers;
+            worker.UnlinkSuspended(fiber);
+            DestroyFiber(fiber);
+        }
+    }
+}
+
+Fiber* FiberRuntime::GetCurrentFiber()
+{
+    return CurrentFiber;
+}
+
+void FiberRuntime::SuspendCurrentFiber()
+{
+    Fiber* const fiber = CurrentFiber;
+    THREAD_POOL_ASSERT("Attempt to suspend outside of a fiber", fiber != nullptr);
+
+    fiber->State = Fiber::FiberState::Suspended;
+
+    // После продолжения волокно может выполняться другим потоком ОС (WorkerArena), поэтому
+    // thread_local переменные здесь больше не читаются.
+    SwitchContext(fiber->Context, fiber->Worker.SchedulerContext);
+}
+
+void FiberRuntime::Resume(Fiber* const fiber)
+{
+    // Волокно может быть продолжено и завершено сразу после добавления в очередь,
+    // поэтому его поля считываются заранее.
+    FiberRuntime&  runtime = fiber->Runtime;
+    ThreadHandler& handler = *fiber->Worker.Handler;
+
+    fiber->Worker.PushReady(fiber);
+    runtime.Pool.WakeHandler(handler);
+}
+
+size_t FiberRuntime::GetFibersCount() const
+{
+    return FibersCount.load(std::memory_order_relaxed);
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+void FiberRuntime::RunTask(ThreadHandler& handler, TaskBase* const task)
+{
+    FiberWorker& worker = Workers[handler.GetIndex()];
+
+    Fiber* const fiber = AcquireFiber(worker);
+    fiber->Task = task;
+
+    SwitchToFiber(worker, fiber);
+}
+
+bool FiberRuntime::ResumeReadyFiber(ThreadHandler& handler)
+{
+    FiberWorker& worker = Workers[handler.GetIndex()];
+
+    Fiber* const fiber = worker.TryPopReady();
+    if (fiber == nullptr)
+        return false;
+
+    // Волокно попадает в очередь готовых только после приостановки: очередь разбирает тот же
+    // поток, который обработал приостановку.
+    worker.UnlinkSuspended(fiber);
+    SwitchToFiber(worker, fiber);
+    return true;
+}
+
+bool FiberRuntime::HasReadyFibers(ThreadHandler& handler) const
+{
+    return Workers[handler.GetIndex()].HasReady();
+}
+
+std::vector<TaskBase*> FiberRuntime::ExtractSuspendedTasks()
+{
+    std::vector<TaskBase*> tasks;
+
+    for (size_t st = 0; st < WorkersCount; st++)
+    {
+        for (Fiber* fiber = Workers[st].SuspendedFibers; fiber != nullptr; fiber = fiber->NextSuspended)
+        {
+            tasks.push_back(fiber->Task);
+            fiber->Task = nullptr;
+        }
+    }
+
+    return tasks;
+}
+
+void FiberRuntime::SwitchToFiber(FiberWorker& worker, Fiber* const fiber)
+{
+    fiber->State = Fiber::FiberState::Running;
+
+#ifdef THREAD_POOL_FIBER_TSAN
+    worker.SchedulerContext.SanitizerFiber = __tsan_get_current_fiber();
+#endif
+
+    CurrentFiber = fiber;
+    SwitchContext(worker.SchedulerContext, fiber->Context);
+    CurrentFiber = nullptr;
+
+    if (fiber->State == Fiber::FiberState::Finished)
+        ReleaseFiber(worker, fiber);
+    else
+        worker.LinkSuspended(fiber);
+}
+
+Fiber* FiberRuntime::AcquireFiber(FiberWorker& worker)
+{
+    if (!worker.FreeFibers.empty())
+    {
+        Fiber* const fiber = worker.FreeFibers.back();
+        worker.FreeFibers.pop_back();
+        return fiber;
+    }
+
+    Fiber* const fiber = new Fiber(*this, worker);
+
+    fiber->MemorySize = StackSize + FiberPageSize;
+    fiber->Memory     = AllocateStack(fiber->MemorySize);
+
+    char* const stackBottom = fiber->Memory + FiberPageSize;
+    fiber->Context.StackBottom = stackBottom;
+    fiber->Context.StackSize   = StackSize;
+#ifdef THREAD_POOL_FIBER_TSAN
+    fiber->Context.SanitizerFiber = __tsan_create_fiber(0);
+#endif
+
+    PrepareContext(fiber->Context, stackBottom, StackSize, FiberMain, fiber);
+
+    FibersCount.fetch_add(1, std::memory_order_relaxed);
+    return fiber;
+}
+
+void FiberRuntime::ReleaseFiber(FiberWorker& worker, Fiber* const fiber)
+{
+    // Волокно остановлено в FiberMain() и при следующем продолжении выполнит новое задание,
+    // поэтому стек не нужно подготавливать заново.
+    if (worker.FreeFibers.size() < CachedStacksCount)
+        worker.FreeFibers.push_back(fiber);
+    else
+        DestroyFiber(fiber);
+}
+
+void FiberRuntime::DestroyFiber(Fiber* const fiber)
+{
+#ifdef THREAD_POOL_FIBER_TSAN
+    __tsan_destroy_fiber(fiber->Context.SanitizerFiber);
+#endif
+
+    FreeStack(fiber->Memory, fiber->MemorySize);
+    delete fiber;
+
+    FibersCount.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void FiberRuntime::FiberMain(void* const fiberPtr)
+{
+    Fiber* const fiber = static_cast<Fiber*>(fiberPtr);
+
+#ifdef THREAD_POOL_FIBER_ASAN
+    __sanitizer_finish_switch_fiber(nullptr, &fiber->Worker.SchedulerContext.StackBottom,
+                                    &fiber->Worker.SchedulerContext.StackSize);
+#endif
+
+    // Волокно не завершается: после задания оно возвращается в цикл потока и ожидает
+    // следующего задания здесь же.
+    while (true)
+    {
+        ThreadHandler& handler = *fiber->Worker.Handler;
+        THREAD_POOL_PRINTF("Thread #%zd is starting task %zd on fiber\n", handler.GetIndex(), fiber->Task->Id);
+
+        // Исключение не должно выйти из FiberMain(): выше по стеку волокна только
+        // ThreadPoolFiberTrampoline(), через который раскрутка невозможна. Исключение
+        // ожидаемого задания сохраняет std::packaged_task, остальные отбрасываются.
+        try
+        {
+            fiber->Task->Execute();
+        }
+        catch (...)
+        {
+            THREAD_POOL_PRINTF("Thread #%zd: task %zd threw an exception\n", handler.GetIndex(), fiber->Task->Id);
+        }
+
+        fiber->Runtime.Pool.FinishFiberTask(handler, fiber->Task);
+
+        fiber->Task  = nullptr;
+        fiber->State = Fiber::FiberState::Finished;
+        SwitchContext(fiber->Context, fiber->Worker.SchedulerContext);
+    }
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
@@ -0,0 +1,154 @@
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+// Модуль ThreadPool, выполнение заданий в волокнах (fibers).
+//
+// Версия: 1.0.0.0
+// Дата последнего изменения: 19.10.2026
+//
+// Автор: Маслов А.С. (https://github.com/ArtemMaslov).
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+#pragma once
+
+#include <cstddef>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+namespace ThreadPoolModule
+{
+    class TaskBase;
+    class ThreadHandler;
+    class ThreadPoolBase;
+    class Fiber;
+    class FiberWorker;
+
+    /**
+     * @brief Параметры выполнения заданий в волокнах.
+    */
+    struct FiberSettings
+    {
+        /// Размер стека волокна в байтах. Округляется вверх до размера страницы, под стеком
+        /// дополнительно выделяется защитная страница.
+        size_t StackSize         = 64 * 1024;
+        /// Количество свободных стеков, которые каждый поток хранит для повторного использования.
+        /// Лишние стеки возвращаются системе.
+        size_t CachedStacksCount = 64;
+    };
+
+    /**
+     * @brief Выполнение заданий ThreadPool в волокнах - потоках пользовательского режима.
+     *
+     * Каждое задание выполняется на собственном небольшом стеке. Если задание ожидает другое
+     * задание (ThreadPool::Wait()), то его волокно приостанавливается, а поток ThreadPool
+     * выполняет другие задания. Когда ожидаемое задание выполнено, волокно продолжается тем же
+     * потоком ThreadPool. Поэтому ожидающие задания не занимают потоки ОС, и их количество
+     * ограничено памятью под стеки. Стек с защитной страницей - это два отображения памяти,
+     * а Linux по умолчанию разрешает процессу 65530 отображений (vm.max_map_count), поэтому
+     * одновременно может существовать около 30 тысяч волокон.
+     *
+     * Переключение волокон сохраняет только регистры, которые функция обязана сохранять, и
+     * не выполняет системных вызовов.
+     *
+     * Создаётся вызовом ThreadPoolBase::EnableFibers() и уничтожается вместе с ThreadPool.
+     * Поддерживается в Linux и других POSIX-системах, на остальных конструктор завершает
+     * программу.
+    */
+    class FiberRuntime
+    {
+    public:
+        FiberRuntime(ThreadPoolBase& pool, const FiberSettings& settings);
+
+        FiberRuntime(const FiberRuntime&)            = delete;
+        FiberRuntime& operator=(const FiberRuntime&) = delete;
+
+        /**
+         * @brief Освобождает стеки. Волокна, приостановленные при уничтожении ThreadPool,
+         * не продолжаются, деструкторы объектов на их стеках не вызываются.
+        */
+        ~FiberRuntime();
+
+        /**
+         * @brief Получить волокно, в котором выполняется вызов.
+         *
+         * @return Волокно или nullptr, если вызов выполняется не в волокне.
+        */
+        static Fiber* GetCurrentFiber();
+
+        /**
+         * @brief Приостановить текущее волокно. Поток ThreadPool продолжает выполнять другие
+         * задания, а волокно продолжится после вызова Resume().
+         *
+         * Resume() может быть вызван другим потоком ещё до приостановки, тогда волокно
+         * продолжится сразу.
+        */
+        static void SuspendCurrentFiber();
+
+        /**
+         * @brief Продолжить приостановленное волокно в его потоке ThreadPool.
+        */
+        static void Resume(Fiber* const fiber);
+
+        /**
+         * @brief Получить количество созданных волокон, включая свободные.
+        */
+        size_t GetFibersCount() const;
+
+    private:
+        friend class ThreadPoolBase;
+
+        /**
+         * @brief Выполнить задание в волокне. Вызывается потоком ThreadPool.
+        */
+        void RunTask(ThreadHandler& handler, TaskBase* const task);
+
+        /**
+         * @brief Продолжить одно из готовых волокон потока.
+         *
+         * @return true, если волокно было продолжено.
+        */
+        bool ResumeReadyFiber(ThreadHandler& handler);
+
+        /**
+         * @brief Проверить, есть ли у потока готовые к продолжению волокна. Не захватывает мьютекс.
+        */
+        bool HasReadyFibers(ThreadHandler& handler) const;
+
+        /**
+         * @brief Забрать задания приостановленных волокон. Вызывается после завершения потоков.
+        */
+        std::vector<TaskBase*> ExtractSuspendedTasks();
+
+        /**
+         * @brief Переключиться из цикла потока в волокно и обработать его состояние после возврата.
+        */
+        void SwitchToFiber(FiberWorker& worker, Fiber* const fiber);
+
+        Fiber* AcquireFiber(FiberWorker& worker);
+
+        void ReleaseFiber(FiberWorker& worker, Fiber* const fiber);
+
+        void DestroyFiber(Fiber* const fiber);
+
+        /**
+         * @brief Точка входа волокна. Выполняет задания, пока волокно используется.
+        */
+        static void FiberMain(void* const fiberPtr);
+
+        ThreadPoolBase&                Pool;
+        /// Размер стека с учётом округления.
+        size_t                         StackSize;
+        size_t                         CachedStacksCount;
+        /// Данные потоков, индекс совпадает с ThreadHandler::GetIndex().
+        std::unique_ptr<FiberWorker[]> Workers;
+        /// Количество потоков. Потоки ThreadPool удаляются раньше FiberRuntime.
+        size_t                         WorkersCount;
+
+        std::atomic<size_t>            FibersCount = 0;
+    };
+};
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
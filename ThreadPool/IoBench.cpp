@@ -0,0 +1,229 @@
+#include <iostream>
+#include <chrono>
+#include <atomic>
+#include <vector>
+#include <random>
+#include <cstdlib>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "ThreadPool.h"
+
+using ThreadPoolModule::ThreadPool;
+using ThreadPoolModule::AsyncFileIo;
+using ThreadPoolModule::AsyncIoSettings;
+using ThreadPoolModule::AsyncIoBackendType;
+using ThreadPoolModule::IoBuffer;
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+/// Общие данные цепочек асинхронных чтений.
+struct ReadContext
+{
+    AsyncFileIo*                 Io;
+    size_t                       FileIndex;
+    const std::vector<uint64_t>* Offsets;
+    size_t                       ChainsCount;
+    std::atomic<uint64_t>        Checksum = 0;
+    std::atomic<size_t>          ErrorsCount = 0;
+};
+
+static bool CreateBenchFile(const char* const fileName);
+
+static void BenchBlocking(const char* const name, const int fd, const std::vector<uint64_t>& offsets);
+
+static void BenchAsync(const char* const name, const int fd, const std::vector<uint64_t>& offsets,
+                       const AsyncIoBackendType backend);
+
+static void SubmitRead(ReadContext* const context, IoBuffer* const buffer, const size_t readIndex);
+
+static uint64_t BlockChecksum(const void* const data, const size_t size);
+
+static void PrintResult(const char* const name, const size_t readsCount,
+                        const std::chrono::steady_clock::duration duration, const uint64_t checksum);
+
+static const char* const BenchFileName = "IoBench.tmp";
+
+static const size_t BenchThreadsCount = 2;
+static const size_t BenchBlockSize    = 64 * 1024;
+static const size_t BenchFileSize     = 256 * 1024 * 1024;
+static const size_t BenchReadsCount   = 8192;
+/// Количество одновременно выполняемых асинхронных чтений.
+static const size_t BenchInFlightCount = 64;
+static const size_t BenchRepeatsCount  = 3;
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+int main()
+{
+    if (!CreateBenchFile(BenchFileName))
+    {
+        fprintf(stderr, "Failed to create %s\n", BenchFileName);
+        return 1;
+    }
+
+    // Без O_DIRECT файл читается из кэша страниц и замер показывает только накладные расходы.
+    bool isDirect = true;
+    int  fd       = open(BenchFileName, O_RDONLY | O_DIRECT);
+    if (fd < 0)
+    {
+        isDirect = false;
+        fd       = open(BenchFileName, O_RDONLY);
+    }
+
+    std::mt19937_64 random(2026);
+    std::vector<uint64_t> offsets(BenchReadsCount);
+    for (uint64_t& offset: offsets)
+        offset = random() % (BenchFileSize / BenchBlockSize) * BenchBlockSize;
+
+    printf("threads = %zd, reads = %zd x %zd KiB, in flight = %zd, O_DIRECT = %s\n",
+           BenchThreadsCount, BenchReadsCount, BenchBlockSize / 1024, BenchInFlightCount,
+           isDirect ? "yes" : "no");
+    printf("%-40s %12s %10s %20s\n", "configuration", "time, ms", "MiB/s", "checksum");
+
+    for (size_t st = 0; st < BenchRepeatsCount; st++)
+    {
+        BenchBlocking("Blocking pread() in AddTask", fd, offsets);
+        BenchAsync("AsyncFileIo, io_uring", fd, offsets, AsyncIoBackendType::IoUring);
+        BenchAsync("AsyncFileIo, I/O threads", fd, offsets, AsyncIoBackendType::Threads);
+    }
+
+    close(fd);
+    unlink(BenchFileName);
+
+    return 0;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+static bool CreateBenchFile(const char* const fileName)
+{
+    const int fd = open(fileName, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+        return false;
+
+    std::mt19937_64 random(19);
+    std::vector<uint64_t> block(BenchBlockSize / sizeof(uint64_t));
+
+    bool isWritten = true;
+    for (size_t offset = 0; offset < BenchFileSize && isWritten; offset += BenchBlockSize)
+    {
+        for (uint64_t& value: block)
+            value = random();
+        isWritten = pwrite(fd, block.data(), BenchBlockSize, offset) == BenchBlockSize;
+    }
+
+    fsync(fd);
+    close(fd);
+    return isWritten;
+}
+
+static void BenchBlocking(const char* const name, const int fd, const std::vector<uint64_t>& offsets)
+{
+    std::atomic<uint64_t> checksum = 0;
+
+    ThreadPool threadPool(BenchThreadsCount);
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (const uint64_t offset: offsets)
+    {
+        threadPool.AddTask(false, [fd, offset, &checksum]()
+        {
+            // O_DIRECT требует выровненный буфер.
+            thread_local std::unique_ptr<void, void (*)(void*)> buffer(
+                std::aligned_alloc(4096, BenchBlockSize), std::free);
+
+            const ssize_t result = pread(fd, buffer.get(), BenchBlockSize, offset);
+            if (result > 0)
+                checksum.fetch_add(BlockChecksum(buffer.get(), result), std::memory_order_relaxed);
+        });
+    }
+
+    threadPool.WaitAll();
+
+    PrintResult(name, offsets.size(), std::chrono::steady_clock::now() - start, checksum.load());
+}
+
+static void BenchAsync(const char* const name, const int fd, const std::vector<uint64_t>& offsets,
+                       const AsyncIoBackendType backend)
+{
+    ThreadPool threadPool(BenchThreadsCount);
+
+    AsyncIoSettings settings;
+    settings.Backend      = backend == AsyncIoBackendType::IoUring ? AsyncIoBackendType::Auto : backend;
+    settings.BuffersCount = BenchInFlightCount;
+    settings.BufferSize   = BenchBlockSize;
+
+    AsyncFileIo& asyncIo = threadPool.EnableAsyncIo(settings);
+    if (backend == AsyncIoBackendType::IoUring && !asyncIo.IsUsingIoUring())
+    {
+        printf("%-40s %12s\n", name, "io_uring is not supported");
+        return;
+    }
+
+    ReadContext context;
+    context.Io          = &asyncIo;
+    context.FileIndex   = asyncIo.RegisterFile(fd);
+    context.Offsets     = &offsets;
+    context.ChainsCount = BenchInFlightCount;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    // Каждый буфер читает свою цепочку блоков: следующее чтение отправляется из продолжения.
+    for (size_t st = 0; st < BenchInFlightCount && st < offsets.size(); st++)
+        SubmitRead(&context, asyncIo.TryAcquireBuffer(), st);
+
+    threadPool.WaitAll();
+
+    PrintResult(name, offsets.size(), std::chrono::steady_clock::now() - start, context.Checksum.load());
+
+    if (context.ErrorsCount.load() != 0)
+        printf("%zd reads failed\n", context.ErrorsCount.load());
+
+    asyncIo.UnregisterFile(context.FileIndex);
+}
+
+static void SubmitRead(ReadContext* const context, IoBuffer* const buffer, const size_t readIndex)
+{
+    context->Io->ReadFixed(context->FileIndex, (*context->Offsets)[readIndex], buffer, BenchBlockSize,
+                           [context, buffer, readIndex](const int64_t result)
+    {
+        if (result > 0)
+            context->Checksum.fetch_add(BlockChecksum(buffer->Data, result), std::memory_order_relaxed);
+        else
+            context->ErrorsCount.fetch_add(1, std::memory_order_relaxed);
+
+        const size_t nextIndex = readIndex + context->ChainsCount;
+        if (nextIndex < context->Offsets->size())
+            SubmitRead(context, buffer, nextIndex);
+        else
+            context->Io->ReleaseBuffer(buffer);
+    });
+}
+
+static uint64_t BlockChecksum(const void* const data, const size_t size)
+{
+    const uint64_t* const values = static_cast<const uint64_t*>(data);
+
+    uint64_t checksum = 0;
+    for (size_t st = 0; st < size / sizeof(uint64_t); st++)
+        checksum += values[st];
+    return checksum;
+}
+
+static void PrintResult(const char* const name, const size_t readsCount,
+                        const std::chrono::steady_clock::duration duration, const uint64_t checksum)
+{
+    const double milliseconds = std::chrono::duration<double, std::milli>(duration).count();
+    const double mebibytes    = readsCount * BenchBlockSize / (1024.0 * 1024.0);
+    printf("%-40s %12.2lf %10.0lf %20llu\n", name, milliseconds, mebibytes * 1000.0 / milliseconds,
+           static_cast<unsigned long long>(checksum));
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
@@ -0,0 +1,605 @@
+#include <iostream>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <random>
+#include <string>
+#include <cstring>
+#include <cstdlib>
+#include <bit>
+#include <algorithm>
+
+#include "ThreadPool.h"
+
+using ThreadPoolModule::ThreadPool;
+using ThreadPoolModule::FireAndForgetThreadPool;
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+/**
+ * @brief Гистограмма задержек с логарифмически-линейными корзинами, как в HdrHistogram.
+ *
+ * Значения меньше SubBucketsCount хранятся точно. Каждый следующий диапазон [2^k, 2^(k+1))
+ * делится на SubBucketsCount / 2 равных корзин, поэтому относительная погрешность не
+ * превышает 2 / SubBucketsCount при постоянном объёме памяти.
+*/
+class LatencyHistogram
+{
+public:
+    LatencyHistogram();
+
+    /**
+     * @brief Учесть значение в наносекундах.
+    */
+    void Record(const uint64_t value);
+
+    /**
+     * @brief Получить значение, которое не превышают percentile процентов записей.
+     *
+     * @return Верхняя граница корзины, в которую попало значение.
+    */
+    uint64_t GetValueAtPercentile(const double percentile) const;
+
+    uint64_t GetMax() const;
+
+    uint64_t GetCount() const;
+
+private:
+    static size_t GetBucketIndex(const uint64_t value);
+
+    static uint64_t GetBucketUpperBound(const size_t index);
+
+    static constexpr size_t SubBucketsBits  = 8;
+    static constexpr size_t SubBucketsCount = 1 << SubBucketsBits;
+    static constexpr size_t HalfCount       = SubBucketsCount / 2;
+    static constexpr size_t BucketsCount    = SubBucketsCount + (64 - SubBucketsBits) * HalfCount;
+
+    std::vector<uint64_t> Counts;
+    uint64_t              TotalCount = 0;
+    uint64_t              MaxValue   = 0;
+};
+
+/// Распределение моментов поступления заданий.
+enum class ArrivalType
+{
+    /// Пуассоновский поток: интервалы между заданиями распределены экспоненциально.
+    Poisson,
+    /// Пачки из BurstSize заданий, моменты начала пачек образуют пуассоновский поток.
+    Bursty
+};
+
+/// Время выполнения задания и его доля в смеси.
+struct ServiceClass
+{
+    uint64_t DurationNs;
+    double   Weight;
+};
+
+/// Тип ThreadPool, на который подаётся нагрузка.
+enum class PoolType
+{
+    Mutex,
+    LockFree,
+    Fibers
+};
+
+struct LoadSettings
+{
+    PoolType                  Pool         = PoolType::Mutex;
+    size_t                    ThreadsCount = 0;
+    ArrivalType               Arrivals     = ArrivalType::Poisson;
+    size_t                    BurstSize    = 16;
+    std::vector<ServiceClass> Mix;
+    /// Предлагаемая нагрузка в долях от пропускной способности потоков.
+    std::vector<double>       Loads;
+    /// Длительность одного шага нагрузки в секундах.
+    double                    StepSeconds  = 1.0;
+    /// Файл для построения кривой задержка-пропускная способность, пустой - не записывать.
+    std::string               CsvFileName;
+};
+
+/// Моменты жизни одного задания в наносекундах от начала шага.
+struct ArrivalRecord
+{
+    /// Момент, в который задание должно было поступить по расписанию.
+    int64_t  Intended;
+    /// Момент фактического вызова AddTask.
+    int64_t  Submitted;
+    int64_t  Started;
+    int64_t  Finished;
+    uint64_t ServiceNs;
+};
+
+/// Результаты одного шага нагрузки.
+struct LoadResult
+{
+    double           OfferedRate;
+    double           Throughput;
+    /// Поступление по расписанию -> начало выполнения.
+    LatencyHistogram QueueLatency;
+    /// Поступление по расписанию -> завершение выполнения.
+    LatencyHistogram ResponseLatency;
+    /// Фактическое добавление -> завершение, без поправки на скоординированное упущение.
+    LatencyHistogram UncorrectedLatency;
+    /// Отставание генератора от расписания.
+    LatencyHistogram GeneratorLag;
+};
+
+static bool ParseArguments(const int argc, const char* const argv[], LoadSettings& settings);
+
+static void PrintUsage();
+
+static void BuildSchedule(const LoadSettings& settings, const double rate,
+                          std::vector<ArrivalRecord>& records);
+
+template <typename Pool>
+static void DriveLoad(Pool& threadPool, std::vector<ArrivalRecord>& records);
+
+static void RunLoadStep(const LoadSettings& settings, std::vector<ArrivalRecord>& records);
+
+static LoadResult CollectResult(const std::vector<ArrivalRecord>& records, const double offeredRate);
+
+static void PrintResult(const double load, const LoadResult& result);
+
+static void WriteCsvResult(FILE* const file, const LoadSettings& settings, const double load,
+                           const LoadResult& result);
+
+static const char* GetPoolName(const PoolType pool);
+
+static int64_t GetNanoseconds(const std::chrono::steady_clock::time_point start);
+
+/// Доля шага, задания которой не учитываются: потоки и кэши ещё не вышли на установившийся режим.
+static const double WarmupShare = 0.1;
+/// Если до следующего задания дольше, генератор засыпает, иначе уступает процессор.
+static const int64_t GeneratorSleepThresholdNs = 200'000;
+static const size_t  MaxArrivalsCount          = 20'000'000;
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+int main(const int argc, const char* const argv[])
+{
+    LoadSettings settings;
+    if (!ParseArguments(argc, argv, settings))
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    double meanServiceNs = 0;
+    double weightsSum    = 0;
+    for (const ServiceClass& serviceClass: settings.Mix)
+    {
+        meanServiceNs += serviceClass.DurationNs * serviceClass.Weight;
+        weightsSum    += serviceClass.Weight;
+    }
+    meanServiceNs /= weightsSum;
+
+    // Пропускная способность, при которой потоки заняты всё время.
+    const double capacity = settings.ThreadsCount * 1e9 / meanServiceNs;
+
+    printf("pool = %s, threads = %zd, arrivals = %s, mean service = %.1lf us, capacity = %.0lf tasks/s\n",
+           GetPoolName(settings.Pool), settings.ThreadsCount,
+           settings.Arrivals == ArrivalType::Poisson ? "poisson" : "bursty",
+           meanServiceNs / 1000.0, capacity);
+    printf("latency from intended arrival time, us\n");
+    printf("%6s %10s %10s | %8s %8s %8s | %8s %8s %8s %8s %8s | %10s %8s\n",
+           "load", "offered/s", "done/s", "q p50", "q p99", "q p999",
+           "r p50", "r p90", "r p99", "r p999", "r max", "uncorr p99", "lag p99");
+
+    FILE* csvFile = nullptr;
+    if (!settings.CsvFileName.empty())
+    {
+        csvFile = fopen(settings.CsvFileName.c_str(), "w");
+        if (!csvFile)
+        {
+            fprintf(stderr, "Failed to create %s\n", settings.CsvFileName.c_str());
+            return 1;
+        }
+        fprintf(csvFile, "pool,threads,arrivals,load,offered_rate,throughput,"
+                         "queue_p50_us,queue_p99_us,queue_p999_us,"
+                         "response_p50_us,response_p90_us,response_p99_us,response_p999_us,"
+                         "response_max_us,uncorrected_p99_us,generator_lag_p99_us\n");
+    }
+
+    std::vector<ArrivalRecord> records;
+    for (const double load: settings.Loads)
+    {
+        const double rate = load * capacity;
+
+        BuildSchedule(settings, rate, records);
+        RunLoadStep(settings, records);
+
+        const LoadResult result = CollectResult(records, rate);
+        PrintResult(load, result);
+        if (csvFile)
+            WriteCsvResult(csvFile, settings, load, result);
+    }
+
+    if (csvFile)
+        fclose(csvFile);
+
+    return 0;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+LatencyHistogram::LatencyHistogram() :
+    Counts(BucketsCount)
+{
+}
+
+void LatencyHistogram::Record(const uint64_t value)
+{
+    Counts[GetBucketIndex(value)]++;
+    TotalCount++;
+    if (value > MaxValue)
+        MaxValue = value;
+}
+
+uint64_t LatencyHistogram::GetValueAtPercentile(const double percentile) const
+{
+    if (TotalCount == 0)
+        return 0;
+
+    uint64_t targetCount = static_cast<uint64_t>(percentile / 100.0 * TotalCount + 0.5);
+    if (targetCount == 0)
+        targetCount = 1;
+
+    uint64_t count = 0;
+    for (size_t st = 0; st < BucketsCount; st++)
+    {
+        count += Counts[st];
+        if (count >= targetCount)
+            return std::min(GetBucketUpperBound(st), MaxValue);
+    }
+
+    return MaxValue;
+}
+
+uint64_t LatencyHistogram::GetMax() const
+{
+    return MaxValue;
+}
+
+uint64_t LatencyHistogram::GetCount() const
+{
+    return TotalCount;
+}
+
+size_t LatencyHistogram::GetBucketIndex(const uint64_t value)
+{
+    if (value < SubBucketsCount)
+        return value;
+
+    // Старшие SubBucketsBits бит значения, старший из них всегда установлен.
+    const size_t shift = std::bit_width(value) - SubBucketsBits;
+    return SubBucketsCount + (shift - 1) * HalfCount + ((value >> shift) - HalfCount);
+}
+
+uint64_t LatencyHistogram::GetBucketUpperBound(const size_t index)
+{
+    if (index < SubBucketsCount)
+        return index;
+
+    const size_t   shift     = (index - SubBucketsCount) / HalfCount + 1;
+    const uint64_t subBucket = (index - SubBucketsCount) % HalfCount + HalfCount;
+    return ((subBucket + 1) << shift) - 1;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+static bool ParseArguments(const int argc, const char* const argv[], LoadSettings& settings)
+{
+    const size_t hardwareThreads = std::thread::hardware_concurrency();
+    // Одно ядро остаётся генератору нагрузки.
+    settings.ThreadsCount = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+
+    std::string mix   = "10:90,100:9,1000:1";
+    std::string loads = "0.1,0.3,0.5,0.7,0.8,0.9,0.95";
+
+    for (int st = 1; st < argc; st++)
+    {
+        const char* const argument = argv[st];
+        const char* const value    = strchr(argument, '=');
+        if (!value)
+            return false;
+
+        const std::string key(argument, value - argument);
+        const char* const text = value + 1;
+
+        if (key == "pool")
+        {
+            if (strcmp(text, "mutex") == 0)
+                settings.Pool = PoolType::Mutex;
+            else if (strcmp(text, "lockfree") == 0)
+                settings.Pool = PoolType::LockFree;
+            else if (strcmp(text, "fibers") == 0)
+                settings.Pool = PoolType::Fibers;
+            else
+                return false;
+        }
+        else if (key == "threads")
+            settings.ThreadsCount = strtoull(text, nullptr, 10);
+        else if (key == "arrivals")
+        {
+            if (strcmp(text, "poisson") == 0)
+                settings.Arrivals = ArrivalType::Poisson;
+            else if (strcmp(text, "bursty") == 0)
+                settings.Arrivals = ArrivalType::Bursty;
+            else
+                return false;
+        }
+        else if (key == "burst")
+            settings.BurstSize = strtoull(text, nullptr, 10);
+        else if (key == "mix")
+            mix = text;
+        else if (key == "loads")
+            loads = text;
+        else if (key == "time")
+            settings.StepSeconds = strtod(text, nullptr);
+        else if (key == "csv")
+            settings.CsvFileName = text;
+        else
+            return false;
+    }
+
+    // Смесь задаётся как "длительность_мкс:вес,...".
+    for (const char* item = mix.c_str(); *item; )
+    {
+        char* end = nullptr;
+        const double durationUs = strtod(item, &end);
+        if (end == item || *end != ':')
+            return false;
+
+        item = end + 1;
+        const double weight = strtod(item, &end);
+        if (end == item || weight <= 0)
+            return false;
+
+        settings.Mix.push_back({ static_cast<uint64_t>(durationUs * 1000.0), weight });
+
+        item = *end == ',' ? end + 1 : end;
+        if (*end != ',' && *end != '\0')
+            return false;
+    }
+
+    for (const char* item = loads.c_str(); *item; )
+    {
+        char* end = nullptr;
+        const double load = strtod(item, &end);
+        if (end == item || load <= 0)
+            return false;
+
+        settings.Loads.push_back(load);
+
+        item = *end == ',' ? end + 1 : end;
+        if (*end != ',' && *end != '\0')
+            return false;
+    }
+
+    return settings.ThreadsCount > 0 && settings.BurstSize > 0 && settings.StepSeconds > 0 &&
+           !settings.Mix.empty() && !settings.Loads.empty();
+}
+
+static void PrintUsage()
+{
+    fprintf(stderr,
+            "usage: LoadBench [key=value]...\n"
+            "  pool=mutex|lockfree|fibers  ThreadPool configuration (mutex)\n"
+            "  threads=N                   worker threads (cores - 1)\n"
+            "  arrivals=poisson|bursty     arrival process (poisson)\n"
+            "  burst=N                     tasks per burst for bursty arrivals (16)\n"
+            "  mix=us:weight,...           task durations mix (10:90,100:9,1000:1)\n"
+            "  loads=x,...                 offered load as a share of capacity (0.1,...,0.95)\n"
+            "  time=seconds                duration of each load step (1)\n"
+            "  csv=file                    write the latency-throughput curve to file\n");
+}
+
+static void BuildSchedule(const LoadSettings& settings, const double rate,
+                          std::vector<ArrivalRecord>& records)
+{
+    // Одинаковое зерно для всех шагов и конфигураций, чтобы их можно было сравнивать.
+    std::mt19937_64 random(2026);
+
+    const size_t arrivalsCount = std::min(static_cast<size_t>(rate * settings.StepSeconds), MaxArrivalsCount);
+    records.resize(arrivalsCount);
+
+    std::vector<double> weights;
+    for (const ServiceClass& serviceClass: settings.Mix)
+        weights.push_back(serviceClass.Weight);
+    std::discrete_distribution<size_t> serviceDistribution(weights.begin(), weights.end());
+
+    const size_t burstSize = settings.Arrivals == ArrivalType::Bursty ? settings.BurstSize : 1;
+    // Средняя интенсивность не зависит от размера пачки.
+    std::exponential_distribution<double> intervalDistribution(rate / burstSize);
+
+    double time = 0;
+    for (size_t st = 0; st < arrivalsCount; st++)
+    {
+        if (st % burstSize == 0)
+            time += intervalDistribution(random);
+
+        ArrivalRecord& record = records[st];
+        record.Intended  = static_cast<int64_t>(time * 1e9);
+        record.Submitted = 0;
+        record.Started   = 0;
+        record.Finished  = 0;
+        record.ServiceNs = settings.Mix[serviceDistribution(random)].DurationNs;
+    }
+}
+
+template <typename Pool>
+static void DriveLoad(Pool& threadPool, std::vector<ArrivalRecord>& records)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    // Открытая модель: задания добавляются по расписанию, не дожидаясь выполнения предыдущих.
+    // Если генератор отстал, то просроченные задания добавляются сразу, а задержка считается
+    // от момента по расписанию. Иначе перегруженный ThreadPool замедлял бы генератор и скрывал
+    // собственные задержки (скоординированное упущение, coordinated omission).
+    for (ArrivalRecord& record: records)
+    {
+        int64_t now = GetNanoseconds(start);
+        if (record.Intended - now > GeneratorSleepThresholdNs)
+        {
+            std::this_thread::sleep_until(start + std::chrono::nanoseconds(record.Intended - GeneratorSleepThresholdNs / 2));
+            now = GetNanoseconds(start);
+        }
+        while (now < record.Intended)
+        {
+            std::this_thread::yield();
+            now = GetNanoseconds(start);
+        }
+
+        ArrivalRecord* const recordPtr = &record;
+        record.Submitted = now;
+        threadPool.Post([recordPtr, start]()
+        {
+            const int64_t started = GetNanoseconds(start);
+            recordPtr->Started = started;
+
+            // Задание занимает поток, как вычисления, а не как ожидание.
+            int64_t finished = started;
+            while (finished - started < static_cast<int64_t>(recordPtr->ServiceNs))
+                finished = GetNanoseconds(start);
+
+            recordPtr->Finished = finished;
+        });
+    }
+
+    threadPool.WaitAll();
+}
+
+static void RunLoadStep(const LoadSettings& settings, std::vector<ArrivalRecord>& records)
+{
+    switch (settings.Pool)
+    {
+        case PoolType::Mutex:
+        {
+            ThreadPool threadPool(settings.ThreadsCount);
+            DriveLoad(threadPool, records);
+            break;
+        }
+        case PoolType::LockFree:
+        {
+            FireAndForgetThreadPool threadPool(settings.ThreadsCount);
+            DriveLoad(threadPool, records);
+            break;
+        }
+        case PoolType::Fibers:
+        {
+            ThreadPool threadPool(settings.ThreadsCount);
+            threadPool.EnableFibers();
+            DriveLoad(threadPool, records);
+            break;
+        }
+    }
+}
+
+static LoadResult CollectResult(const std::vector<ArrivalRecord>& records, const double offeredRate)
+{
+    LoadResult result;
+    result.OfferedRate = offeredRate;
+    result.Throughput  = 0;
+
+    if (records.empty())
+        return result;
+
+    const int64_t warmupEnd = static_cast<int64_t>(records.back().Intended * WarmupShare);
+
+    int64_t firstIntended = -1;
+    int64_t lastFinished  = 0;
+    size_t  measuredCount = 0;
+
+    for (const ArrivalRecord& record: records)
+    {
+        if (record.Intended < warmupEnd)
+            continue;
+
+        if (firstIntended < 0)
+            firstIntended = record.Intended;
+        lastFinished = std::max(lastFinished, record.Finished);
+        measuredCount++;
+
+        result.QueueLatency.Record(record.Started - record.Intended);
+        result.ResponseLatency.Record(record.Finished - record.Intended);
+        result.UncorrectedLatency.Record(record.Finished - record.Submitted);
+        result.GeneratorLag.Record(record.Submitted - record.Intended);
+    }
+
+    if (lastFinished > firstIntended)
+        result.Throughput = measuredCount * 1e9 / (lastFinished - firstIntended);
+
+    return result;
+}
+
+static void PrintResult(const double load, const LoadResult& result)
+{
+    const auto us = [](const uint64_t value)
+    {
+        return value / 1000.0;
+    };
+
+    printf("%6.2lf %10.0lf %10.0lf | %8.1lf %8.1lf %8.1lf | %8.1lf %8.1lf %8.1lf %8.1lf %8.1lf | %10.1lf %8.1lf\n",
+           load, result.OfferedRate, result.Throughput,
+           us(result.QueueLatency.GetValueAtPercentile(50)),
+           us(result.QueueLatency.GetValueAtPercentile(99)),
+           us(result.QueueLatency.GetValueAtPercentile(99.9)),
+           us(result.ResponseLatency.GetValueAtPercentile(50)),
+           us(result.ResponseLatency.GetValueAtPercentile(90)),
+           us(result.ResponseLatency.GetValueAtPercentile(99)),
+           us(result.ResponseLatency.GetValueAtPercentile(99.9)),
+           us(result.ResponseLatency.GetMax()),
+           us(result.UncorrectedLatency.GetValueAtPercentile(99)),
+           us(result.GeneratorLag.GetValueAtPercentile(99)));
+}
+
+static void WriteCsvResult(FILE* const file, const LoadSettings& settings, const double load,
+                           const LoadResult& result)
+{
+    const auto us = [](const uint64_t value)
+    {
+        return value / 1000.0;
+    };
+
+    fprintf(file, "%s,%zd,%s,%.3lf,%.0lf,%.0lf,%.1lf,%.1lf,%.1lf,%.1lf,%.1lf,%.1lf,%.1lf,%.1lf,%.1lf,%.1lf\n",
+            GetPoolName(settings.Pool), settings.ThreadsCount,
+            settings.Arrivals == ArrivalType::Poisson ? "poisson" : "bursty",
+            load, result.OfferedRate, result.Throughput,
+            us(result.QueueLatency.GetValueAtPercentile(50)),
+            us(result.QueueLatency.GetValueAtPercentile(99)),
+            us(result.QueueLatency.GetValueAtPercentile(99.9)),
+            us(result.ResponseLatency.GetValueAtPercentile(50)),
+            us(result.ResponseLatency.GetValueAtPercentile(90)),
+            us(result.ResponseLatency.GetValueAtPercentile(99)),
+            us(result.ResponseLatency.GetValueAtPercentile(99.9)),
+            us(result.ResponseLatency.GetMax()),
+            us(result.UncorrectedLatency.GetValueAtPercentile(99)),
+            us(result.GeneratorLag.GetValueAtPercentile(99)));
+}
+
+static const char* GetPoolName(const PoolType pool)
+{
+    switch (pool)
+    {
+        case PoolType::Mutex:
+            return "mutex";
+        case PoolType::LockFree:
+            return "lockfree";
+        case PoolType::Fibers:
+            return "fibers";
+    }
+    return "";
+}
+
+static int64_t GetNanoseconds(const std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
@@ -0,0 +1,155 @@
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+// Модуль ThreadPool, последовательное выполнение заданий (strand).
+//
+// Версия: 1.0.0.0
+// Дата последнего изменения: 19.10.2026
+//
+// Автор: Маслов А.С. (https://github.com/ArtemMaslov).
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+#pragma once
+
+#include <cstddef>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+#include "ThreadPool.h"
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+namespace ThreadPoolModule
+{
+    /**
+     * @brief Очередь заданий, которые выполняются на ThreadPool строго по порядку и никогда
+     * одновременно.
+     *
+     * Позволяет работать с общими данными (состояние соединения, шарда) без мьютекса внутри
+     * задания. Strand добавляет в ThreadPool задание-обработчик, только когда у него появляется
+     * работа. Обработчик выполняет пачку заданий подряд и добавляет себя повторно, если задания
+     * остались, чтобы strand не занимал поток надолго.
+     *
+     * Задания добавляются без мьютекса: очередь strand - односвязный список для многих
+     * производителей и одного потребителя (очередь Д. Вьюкова).
+     *
+     * Strand должен быть уничтожен раньше ThreadPool, к которому он привязан.
+     *
+     * @tparam PoolType ThreadPool, на котором выполняются задания.
+    */
+    template <typename PoolType>
+    class BasicStrand
+    {
+    public:
+        /// Количество заданий, выполняемых обработчиком strand до повторного добавления в ThreadPool.
+        static constexpr size_t DefaultBatchSize = 64;
+
+        BasicStrand(PoolType& pool, const size_t batchSize = DefaultBatchSize);
+
+        BasicStrand(const BasicStrand&)            = delete;
+        BasicStrand& operator=(const BasicStrand&) = delete;
+
+        /**
+         * @brief Ожидает выполнения всех добавленных заданий, не занимая процессор.
+         *
+         * Если задания ещё не выполнены, то деструктор нельзя вызывать из потока ThreadPool:
+         * ожидающий поток не выполняет задания, и обработчик strand может не дождаться
+         * свободного потока.
+        */
+        ~BasicStrand();
+
+        /**
+         * @brief Добавить задание. Задание будет выполнено после всех ранее добавленных
+         * в этот strand заданий.
+         *
+         * Результат задания не сохраняется, исключение, выброшенное заданием, отбрасывается.
+         * Дождаться выполнения заданий strand можно с помощью WaitAll() у ThreadPool.
+        */
+        template <typename Funct, typename... Args>
+        void Post(Funct funct, Args... args);
+
+        /**
+         * @brief Получить количество добавленных, но ещё не выполненных заданий.
+        */
+        size_t GetPendingTasksCount() const;
+
+        /**
+         * @brief Получить ThreadPool, на котором выполняются задания.
+        */
+        PoolType& GetPool() const;
+
+    private:
+        /// Элемент очереди strand.
+        class Node
+        {
+        public:
+            virtual ~Node() = default;
+
+            virtual void Execute();
+
+            std::atomic<Node*> Next = nullptr;
+        };
+
+        template <typename Callable>
+        class CallableNode : public Node
+        {
+        public:
+            CallableNode(Callable&& callable);
+
+            void Execute() override;
+
+        private:
+            Callable Funct;
+        };
+
+        /**
+         * @brief Добавить обработчик strand в ThreadPool.
+        */
+        void Schedule();
+
+        /**
+         * @brief Выполнить пачку заданий. Вызывается только одним потоком одновременно.
+        */
+        void Drain();
+
+        /**
+         * @brief Выполнить следующее задание из очереди. Исключение задания отбрасывается.
+        */
+        void RunNext();
+
+        /**
+         * @brief Учесть выполнение заданий обработчиком.
+         *
+         * @return Количество оставшихся заданий.
+        */
+        size_t FinishTasks(const size_t count);
+
+        PoolType&    Pool;
+        const size_t BatchSize;
+
+        /// Количество добавленных, но не выполненных заданий. Обработчик находится в ThreadPool,
+        /// пока значение больше нуля. Добавивший первое задание поток добавляет обработчик.
+        alignas(CacheLineSize) std::atomic<size_t> PendingCount = 0;
+        /// Последний добавленный элемент. Изменяется добавляющими потоками.
+        alignas(CacheLineSize) std::atomic<Node*> Head;
+        /// Последний выполненный элемент. Изменяется только обработчиком strand.
+        alignas(CacheLineSize) Node* Tail;
+
+        /// Уменьшение PendingCount до нуля и его ожидание в деструкторе. Обработчик отпускает
+        /// мьютекс последним обращением к strand, поэтому деструктор, захвативший мьютекс после
+        /// этого, может освободить strand.
+        std::mutex              DrainAccess;
+        std::condition_variable DrainedCondition;
+    };
+
+    /// Strand для ThreadPool по умолчанию.
+    typedef BasicStrand<ThreadPool> Strand;
+};
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+#include "Strand_impl.h"
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
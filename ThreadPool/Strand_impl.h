@@ -0,0 +1,203 @@
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+// Модуль ThreadPool, шаблонные методы strand.
+//
+// Версия: 1.0.0.0
+// Дата последнего изменения: 19.10.2026
+//
+// Автор: Маслов А.С. (https://github.com/ArtemMaslov).
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+#include <algorithm>
+#include <functional>
+#include <thread>
+
+#include "Strand.h"
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+namespace ThreadPoolModule
+{
+    template <typename PoolType>
+    BasicStrand<PoolType>::BasicStrand(PoolType& pool, const size_t batchSize) :
+        Pool(pool),
+        BatchSize(batchSize),
+        Head(nullptr),
+        Tail(nullptr)
+    {
+        THREAD_POOL_ASSERT("Strand batch size must be positive", batchSize > 0);
+
+        // Очередь всегда содержит хотя бы один элемент, поэтому добавление и извлечение
+        // не обращаются к одним и тем же полям.
+        Tail = new Node();
+        Head.store(Tail, std::memory_order_relaxed);
+    }
+
+    template <typename PoolType>
+    BasicStrand<PoolType>::~BasicStrand()
+    {
+        if (PendingCount.load(std::memory_order_acquire) != 0)
+        {
+            const ThreadHandler* const handler = ThreadHandler::GetCurrent();
+            THREAD_POOL_ASSERT("Strand with pending tasks is destroyed by a thread of its ThreadPool",
+                               handler == nullptr || &handler->GetHolder() != &Pool);
+        }
+
+        {
+            // Обработчик обращается к strand, пока счётчик больше нуля.
+            std::unique_lock<std::mutex> lock(DrainAccess);
+            DrainedCondition.wait(lock, [this]()
+            {
+                return PendingCount.load(std::memory_order_acquire) == 0;
+            });
+        }
+
+        delete Tail;
+    }
+
+    template <typename PoolType>
+    template <typename Funct, typename... Args>
+    void BasicStrand<PoolType>::Post(Funct funct, Args... args)
+    {
+        typedef decltype(std::bind(funct, args...)) callableType;
+
+        Node* const node = new CallableNode<callableType>(std::bind(funct, args...));
+
+        Node* const prevNode = Head.exchange(node, std::memory_order_acq_rel);
+        prevNode->Next.store(node, std::memory_order_release);
+
+        // Счётчик увеличивается после связывания элемента, поэтому обработчик, увидевший
+        // задание в счётчике, найдёт его в очереди (возможно, подождав другого производителя).
+        if (PendingCount.fetch_add(1, std::memory_order_acq_rel) == 0)
+            Schedule();
+    }
+
+    template <typename PoolType>
+    size_t BasicStrand<PoolType>::GetPendingTasksCount() const
+    {
+        return PendingCount.load(std::memory_order_relaxed);
+    }
+
+    template <typename PoolType>
+    PoolType& BasicStrand<PoolType>::GetPool() const
+    {
+        return Pool;
+    }
+
+    ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+    ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+    template <typename PoolType>
+    void BasicStrand<PoolType>::Schedule()
+    {
+        Pool.Post([this]()
+        {
+            Drain();
+        });
+    }
+
+    template <typename PoolType>
+    void BasicStrand<PoolType>::Drain()
+    {
+        size_t batchLeft = BatchSize;
+        size_t pending   = PendingCount.load(std::memory_order_acquire);
+
+        while (true)
+        {
+            const size_t runCount = std::min(pending, batchLeft);
+            for (size_t st = 0; st < runCount; st++)
+                RunNext();
+            batchLeft -= runCount;
+
+            // Счётчик уменьшается пачкой. Задания, добавленные за это время, будут выполнены
+            // этим же обработчиком.
+            pending = FinishTasks(runCount);
+
+            // Заданий нет: следующий Post() снова добавит обработчик. После уменьшения счётчика
+            // до нуля к strand не обращаемся, он может быть уже уничтожен.
+            if (pending == 0)
+                return;
+
+            // Пачка выполнена, уступаем поток другим заданиям ThreadPool.
+            if (batchLeft == 0)
+            {
+                Schedule();
+                return;
+            }
+        }
+    }
+
+    template <typename PoolType>
+    size_t BasicStrand<PoolType>::FinishTasks(const size_t count)
+    {
+        // Пока задания остаются, счётчик уменьшается без мьютекса.
+        size_t pending = PendingCount.load(std::memory_order_acquire);
+        while (pending > count)
+        {
+            if (PendingCount.compare_exchange_weak(pending, pending - count, std::memory_order_acq_rel))
+                return pending - count;
+        }
+
+        // Счётчик может стать нулём: деструктор должен увидеть это только после того, как
+        // обработчик перестанет обращаться к strand.
+        std::lock_guard<std::mutex> lock(DrainAccess);
+        pending = PendingCount.fetch_sub(count, std::memory_order_acq_rel) - count;
+        if (pending == 0)
+            DrainedCondition.notify_all();
+
+        return pending;
+    }
+
+    template <typename PoolType>
+    void BasicStrand<PoolType>::RunNext()
+    {
+        Node* nextNode = Tail->Next.load(std::memory_order_acquire);
+
+        // Производитель уже изменил Head, но ещё не связал свой элемент с предыдущим.
+        while (nextNode == nullptr)
+        {
+            std::this_thread::yield();
+            nextNode = Tail->Next.load(std::memory_order_acquire);
+        }
+
+        try
+        {
+            nextNode->Execute();
+        }
+        catch (...)
+        {
+            // Как и у не ожидаемого задания ThreadPool, исключение передать некому. Оно
+            // отбрасывается, а strand продолжает выполнять следующие задания.
+        }
+
+        // Выполненный элемент становится началом очереди вместо предыдущего.
+        delete Tail;
+        Tail = nextNode;
+    }
+
+    ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+    ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+    template <typename PoolType>
+    void BasicStrand<PoolType>::Node::Execute()
+    {
+    }
+
+    template <typename PoolType>
+    template <typename Callable>
+    BasicStrand<PoolType>::CallableNode<Callable>::CallableNode(Callable&& callable) :
+        Node(),
+        Funct(std::move(callable))
+    {
+    }
+
+    template <typename PoolType>
+    template <typename Callable>
+    void BasicStrand<PoolType>::CallableNode<Callable>::Execute()
+    {
+        Funct();
+    }
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
@@ -6,10 +6,14 @@
 #include <array>
 #include <functional>
 #include <future>
+#include <atomic>
+#include <thread>
+#include <stdexcept>
 
 #include "ThreadPool.h"
 
 using ThreadPoolModule::ThreadPool;
+using ThreadPoolModule::FireAndForgetThreadPool;
 
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
@@ -17,6 +21,7 @@ using ThreadPoolModule::ThreadPool;
 static int LongTask();
 static int ShortTask();
 static void VoidTask();
+static void ThrowingTask();
 
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
@@ -46,6 +51,85 @@ int main()
 
     threadPool.WaitAll();
 
+    // Результат задания получают, пока другой поток ещё ожидает его в Wait(). Задание
+    // должно освободить последний из них.
+    size_t wrongResultsCount = 0;
+    for (size_t st = 0; st < 200; st++)
+    {
+        std::atomic<bool> isWaiterStarted = false;
+        std::atomic<bool> isGateOpen      = false;
+
+        const ThreadPoolModule::TaskId taskId = threadPool.AddTask(true, [st, &isGateOpen]()
+        {
+            while (!isGateOpen.load())
+                std::this_thread::yield();
+            return st;
+        });
+
+        std::thread waiter([&threadPool, &isWaiterStarted, taskId]()
+        {
+            isWaiterStarted.store(true);
+            threadPool.Wait(taskId);
+        });
+
+        // Задание выполняется, только когда второй поток уже ожидает его.
+        while (!isWaiterStarted.load())
+            std::this_thread::yield();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        isGateOpen.store(true);
+
+        threadPool.Wait(taskId);
+        if (threadPool.GetTaskResult<size_t>(taskId) != st)
+            wrongResultsCount++;
+
+        waiter.join();
+    }
+
+    printf("Wrong results with concurrent Wait: %zd\n", wrongResultsCount);
+
+    if (wrongResultsCount != 0)
+    {
+        printf("Test failed\n");
+        return 1;
+    }
+
+    // Исключение в задании не завершает программу. Не ожидаемые задания учитываются
+    // в WaitAll(), исключение ожидаемого задания передаётся в GetTaskResult().
+    const size_t doneBefore = threadPool.GetDoneTasksCount();
+    for (size_t st = 0; st < 10; st++)
+        threadPool.AddTask(false, ThrowingTask);
+
+    threadPool.WaitAll();
+    const size_t throwingTasksDone = threadPool.GetDoneTasksCount() - doneBefore;
+    printf("Throwing tasks done: %zd of 10\n", throwingTasksDone);
+
+    FireAndForgetThreadPool fireAndForgetPool(2);
+    for (size_t st = 0; st < 10; st++)
+        fireAndForgetPool.Post(ThrowingTask);
+
+    fireAndForgetPool.WaitAll();
+    printf("Throwing tasks done in FireAndForgetThreadPool: %zd of 10\n", fireAndForgetPool.GetDoneTasksCount());
+
+    const ThreadPoolModule::TaskId throwingTaskId = threadPool.AddTask(true, ThrowingTask);
+    threadPool.Wait(throwingTaskId);
+    bool isExceptionCaught = false;
+    try
+    {
+        threadPool.GetTaskResult<void>(throwingTaskId);
+        printf("Exception of waitable task is lost\n");
+    }
+    catch (const std::runtime_error& error)
+    {
+        isExceptionCaught = true;
+        printf("Exception of waitable task: %s\n", error.what());
+    }
+
+    if (throwingTasksDone != 10 || fireAndForgetPool.GetDoneTasksCount() != 10 || !isExceptionCaught)
+    {
+        printf("Test failed\n");
+        return 1;
+    }
+
     return 0;
 }
 
@@ -78,5 +162,10 @@ static void VoidTask()
     fprintf(stderr, "VoidTask #%d is done\n", TaskNumber);
 }
 
+static void ThrowingTask()
+{
+    throw std::runtime_error("ThrowingTask failed");
+}
+
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
\ No newline at end of file
@@ -0,0 +1,118 @@
+#include <iostream>
+#include <atomic>
+#include <string>
+#include <array>
+#include <chrono>
+
+#include "ThreadPool.h"
+
+using ThreadPoolModule::ThreadPool;
+using ThreadPoolModule::ThreadHandler;
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+/// Поток, выполнивший адресованное потоку #0 задание, и время от добавления до начала выполнения.
+struct StealRecord
+{
+    std::chrono::steady_clock::time_point PushTime;
+    size_t                                ThreadIndex = 0;
+    std::chrono::steady_clock::duration   StartDelay  = {};
+};
+
+static void KeyTask(const size_t expectedIndex, std::atomic<size_t>& misplacedCount);
+static void BusyTask();
+static void StealTask(StealRecord* const record);
+
+static const std::chrono::milliseconds StealDelay(50);
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+int main()
+{
+    const size_t threadsCount = 4;
+
+    ThreadPool threadPool(threadsCount);
+
+    // Задания с одинаковым ключом выполняются одним и тем же потоком.
+    std::atomic<size_t> misplacedCount = 0;
+    for (size_t st = 0; st < 100; st++)
+    {
+        const std::string key = "key #" + std::to_string(st % 7);
+        const size_t expectedIndex = std::hash<std::string>()(key) % threadsCount;
+        threadPool.AddTaskForKey(key, false, KeyTask, expectedIndex, std::ref(misplacedCount));
+    }
+
+    threadPool.WaitAll();
+    printf("Tasks executed on a wrong thread: %zd\n", misplacedCount.load());
+
+    // Поток #0 занят, поэтому адресованные ему задания забирают другие потоки, но не раньше,
+    // чем задания пролежат в почтовом ящике StealDelay. Половина заданий добавлена до
+    // включения кражи, задержка для них также отсчитывается от добавления.
+    threadPool.AddTaskOn(0, false, BusyTask);
+
+    std::array<StealRecord, 8> records;
+    for (size_t st = 0; st < records.size(); st++)
+    {
+        if (st == records.size() / 2)
+            threadPool.EnableAffinityStealing(StealDelay);
+
+        records[st].PushTime = std::chrono::steady_clock::now();
+        threadPool.AddTaskOn(0, false, StealTask, &records[st]);
+    }
+
+    threadPool.WaitAll();
+
+    threadPool.DisableAffinityStealing();
+
+    size_t stolenCount      = 0;
+    size_t stolenEarlyCount = 0;
+    for (const StealRecord& record: records)
+    {
+        if (record.ThreadIndex == 0)
+            continue;
+
+        stolenCount++;
+        if (record.StartDelay < StealDelay)
+            stolenEarlyCount++;
+    }
+
+    printf("Tasks stolen from busy thread: %zd of %zd\n", stolenCount, records.size());
+    printf("Tasks stolen before delay:     %zd\n", stolenEarlyCount);
+
+    if (misplacedCount.load() != 0 || stolenCount == 0 || stolenEarlyCount != 0)
+    {
+        printf("Test failed\n");
+        return 1;
+    }
+
+    return 0;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+static void KeyTask(const size_t expectedIndex, std::atomic<size_t>& misplacedCount)
+{
+    if (ThreadHandler::GetCurrent()->GetIndex() != expectedIndex)
+        misplacedCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+static void BusyTask()
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    fprintf(stderr, "BusyTask is done on thread #%zd\n", ThreadHandler::GetCurrent()->GetIndex());
+}
+
+static void StealTask(StealRecord* const record)
+{
+    record->StartDelay  = std::chrono::steady_clock::now() - record->PushTime;
+    record->ThreadIndex = ThreadHandler::GetCurrent()->GetIndex();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    fprintf(stderr, "StealTask is done on thread #%zd\n", record->ThreadIndex);
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
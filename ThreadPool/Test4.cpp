@@ -0,0 +1,109 @@
+#include <iostream>
+#include <vector>
+#include <deque>
+#include <stdexcept>
+
+#include "ThreadPool.h"
+#include "Strand.h"
+
+using ThreadPoolModule::ThreadPool;
+using ThreadPoolModule::Strand;
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+/// Состояние соединения. Изменяется только заданиями своего strand, поэтому мьютекс не нужен.
+struct Connection
+{
+    size_t LastMessage   = 0;
+    size_t OrderErrors   = 0;
+    size_t MessagesCount = 0;
+};
+
+static void OnMessage(Connection* const connection, const size_t message);
+static void OnMessageOrThrow(Connection* const connection, const size_t message);
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+int main()
+{
+    const size_t connectionsCount = 8;
+    const size_t messagesCount    = 10'000;
+
+    ThreadPool threadPool(4);
+
+    std::vector<Connection> connections(connectionsCount);
+    std::deque<Strand>      strands;
+    for (size_t st = 0; st < connectionsCount; st++)
+        strands.emplace_back(threadPool);
+
+    // Сообщения добавляются из нескольких заданий, но каждое соединение получает
+    // их по порядку, так как все сообщения одного соединения добавляются одним заданием.
+    for (size_t index = 0; index < connectionsCount; index++)
+    {
+        threadPool.AddTask(false, [&connections, &strands, index, messagesCount]()
+        {
+            for (size_t message = 1; message <= messagesCount; message++)
+                strands[index].Post(OnMessage, &connections[index], message);
+        });
+    }
+
+    threadPool.WaitAll();
+
+    size_t orderErrors = 0;
+    size_t handledCount = 0;
+    for (const Connection& connection: connections)
+    {
+        orderErrors  += connection.OrderErrors;
+        handledCount += connection.MessagesCount;
+    }
+
+    printf("Messages handled:       %zd of %zd\n", handledCount, connectionsCount * messagesCount);
+    printf("Messages out of order:  %zd\n", orderErrors);
+
+    // Исключение в задании не останавливает strand: следующие задания выполняются,
+    // а деструктор strand не ожидает бесконечно.
+    Connection throwingConnection;
+    {
+        Strand throwingStrand(threadPool);
+        for (size_t message = 1; message <= 100; message++)
+            throwingStrand.Post(OnMessageOrThrow, &throwingConnection, message);
+
+        threadPool.WaitAll();
+    }
+
+    printf("Messages handled after exceptions: %zd of 90\n", throwingConnection.MessagesCount);
+
+    if (handledCount != connectionsCount * messagesCount || orderErrors != 0 ||
+        throwingConnection.MessagesCount != 90)
+    {
+        printf("Test failed\n");
+        return 1;
+    }
+
+    return 0;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+static void OnMessage(Connection* const connection, const size_t message)
+{
+    if (message != connection->LastMessage + 1)
+        connection->OrderErrors++;
+
+    connection->LastMessage = message;
+    connection->MessagesCount++;
+}
+
+static void OnMessageOrThrow(Connection* const connection, const size_t message)
+{
+    if (message % 10 == 0)
+        throw std::runtime_error("Malformed message");
+
+    connection->MessagesCount++;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
@@ -0,0 +1,141 @@
+#include <iostream>
+#include <chrono>
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include "ThreadPool.h"
+
+using ThreadPoolModule::ThreadPool;
+using ThreadPoolModule::WorkerArena;
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+/// Потоки ОС, на которых выполнялись задания обоих ThreadPool.
+static std::mutex                ThreadsAccess;
+static std::set<std::thread::id> UsedThreads;
+
+/// Количество одновременно выполняемых заданий ThreadPool.
+struct ConcurrencyCounter
+{
+    std::atomic<size_t> Running = 0;
+    std::atomic<size_t> Max     = 0;
+};
+
+static ConcurrencyCounter LibraryConcurrency;
+static ConcurrencyCounter ServiceConcurrency;
+
+static void RememberThread();
+
+static void EnterTask(ConcurrencyCounter& counter);
+
+static void LeaveTask(ConcurrencyCounter& counter);
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+int main()
+{
+    const size_t arenaThreadsCount  = 4;
+    const size_t longTasksCount     = 4;
+    const size_t shortTasksCount    = 10'000;
+    const size_t sleepingTasksCount = 100;
+
+    WorkerArena arena(arenaThreadsCount);
+
+    // Библиотека занимает не больше двух потоков арены, сервис - не больше трёх.
+    const size_t libraryShare = 2;
+    const size_t serviceShare = 3;
+    ThreadPool libraryPool(arena, libraryShare);
+    ThreadPool servicePool(arena, serviceShare);
+
+    std::atomic<size_t> longTasksDone = 0;
+    for (size_t st = 0; st < longTasksCount; st++)
+    {
+        libraryPool.AddTask(false, [&longTasksDone]()
+        {
+            EnterTask(LibraryConcurrency);
+            RememberThread();
+            std::this_thread::sleep_for(std::chrono::milliseconds(300));
+            longTasksDone++;
+            LeaveTask(LibraryConcurrency);
+        });
+    }
+
+    std::atomic<size_t> shortTasksDone = 0;
+    for (size_t st = 0; st < shortTasksCount; st++)
+    {
+        servicePool.AddTask(false, [&shortTasksDone]()
+        {
+            EnterTask(ServiceConcurrency);
+            RememberThread();
+            shortTasksDone++;
+            LeaveTask(ServiceConcurrency);
+        });
+    }
+
+    // WaitAll() ожидает только задания своего ThreadPool.
+    servicePool.WaitAll();
+    // Сервис не ожидает, пока библиотека освободит потоки арены.
+    const size_t longTasksDoneBefore = longTasksDone.load();
+    printf("Service tasks done:     %zd of %zd\n", shortTasksDone.load(), shortTasksCount);
+    printf("Library tasks done:     %zd of %zd (still running)\n", longTasksDoneBefore, longTasksCount);
+
+    libraryPool.WaitAll();
+    printf("Library tasks done:     %zd of %zd\n", longTasksDone.load(), longTasksCount);
+
+    // Вся арена свободна, но сервис по-прежнему занимает не больше трёх потоков.
+    for (size_t st = 0; st < sleepingTasksCount; st++)
+    {
+        servicePool.AddTask(false, []()
+        {
+            EnterTask(ServiceConcurrency);
+            RememberThread();
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            LeaveTask(ServiceConcurrency);
+        });
+    }
+    servicePool.WaitAll();
+
+    printf("OS threads used:        %zd (arena size %zd)\n", UsedThreads.size(), arena.GetThreadsCount());
+    printf("Max library tasks:      %zd (share %zd)\n", LibraryConcurrency.Max.load(), libraryShare);
+    printf("Max service tasks:      %zd (share %zd)\n", ServiceConcurrency.Max.load(), serviceShare);
+
+    if (shortTasksDone.load() != shortTasksCount || longTasksDone.load() != longTasksCount ||
+        longTasksDoneBefore == longTasksCount || UsedThreads.size() > arena.GetThreadsCount() ||
+        LibraryConcurrency.Max.load() > libraryShare || ServiceConcurrency.Max.load() > serviceShare)
+    {
+        printf("Test failed\n");
+        return 1;
+    }
+
+    return 0;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+static void RememberThread()
+{
+    std::unique_lock<std::mutex> lock(ThreadsAccess);
+    UsedThreads.insert(std::this_thread::get_id());
+}
+
+static void EnterTask(ConcurrencyCounter& counter)
+{
+    const size_t running = counter.Running.fetch_add(1) + 1;
+
+    size_t max = counter.Max.load();
+    while (running > max && !counter.Max.compare_exchange_weak(max, running))
+        ;
+}
+
+static void LeaveTask(ConcurrencyCounter& counter)
+{
+    counter.Running.fetch_sub(1);
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
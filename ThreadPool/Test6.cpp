@@ -0,0 +1,122 @@
+#include <iostream>
+#include <chrono>
+#include <stdexcept>
+
+#include "ThreadPool.h"
+
+using ThreadPoolModule::ThreadPool;
+using ThreadPoolModule::TaskId;
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+static uint64_t SumRange(ThreadPool* const threadPool, const uint64_t begin, const uint64_t end);
+
+static void ThrowAfterWait(ThreadPool* const threadPool);
+
+/// Размер диапазона, который суммируется без разбиения.
+static const uint64_t LeafSize = 64;
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+int main()
+{
+    const uint64_t valuesCount = 1 << 20;
+
+    // Каждое задание ожидает два дочерних. Без волокон все 4 потока быстро оказались бы
+    // заняты ожидающими заданиями, и дочерние задания некому было бы выполнять.
+    ThreadPool threadPool(4);
+    ThreadPoolModule::FiberRuntime& fibers = threadPool.EnableFibers();
+
+    const auto start = std::chrono::steady_clock::now();
+
+    const TaskId rootId = threadPool.AddTask(true, SumRange, &threadPool, 0, valuesCount);
+    threadPool.Wait(rootId);
+    const uint64_t sum = threadPool.GetTaskResult<uint64_t>(rootId);
+
+    const double milliseconds =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    printf("Sum:            %llu\n", static_cast<unsigned long long>(sum));
+    printf("Expected sum:   %llu\n", static_cast<unsigned long long>(valuesCount * (valuesCount - 1) / 2));
+    printf("Tasks done:     %zd\n", threadPool.GetDoneTasksCount());
+    printf("Fibers created: %zd\n", fibers.GetFibersCount());
+    printf("Time:           %.2lf ms\n", milliseconds);
+
+    // Исключение задания в волокне не завершает программу: ожидаемое задание передаёт его
+    // в GetTaskResult(), исключение остальных отбрасывается.
+    const size_t throwingTasksCount = 10;
+    const size_t doneTasksBefore    = threadPool.GetDoneTasksCount();
+    for (size_t st = 0; st < throwingTasksCount; st++)
+        threadPool.AddTask(false, ThrowAfterWait, &threadPool);
+
+    const TaskId throwingId = threadPool.AddTask(true, ThrowAfterWait, &threadPool);
+    threadPool.Wait(throwingId);
+
+    bool isExceptionCaught = false;
+    try
+    {
+        threadPool.GetTaskResult<void>(throwingId);
+    }
+    catch (const std::runtime_error&)
+    {
+        isExceptionCaught = true;
+    }
+    threadPool.WaitAll();
+
+    // Каждое бросающее задание выполняет одно дочернее.
+    const size_t throwingTasksDone = threadPool.GetDoneTasksCount() - doneTasksBefore;
+    printf("Throwing tasks: %zd of %zd\n", throwingTasksDone, 2 * (throwingTasksCount + 1));
+    printf("Exception:      %s\n", isExceptionCaught ? "yes" : "no");
+
+    if (sum != valuesCount * (valuesCount - 1) / 2 ||
+        throwingTasksDone != 2 * (throwingTasksCount + 1) || !isExceptionCaught)
+    {
+        printf("Test failed\n");
+        return 1;
+    }
+
+    return 0;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+static uint64_t SumRange(ThreadPool* const threadPool, const uint64_t begin, const uint64_t end)
+{
+    if (end - begin <= LeafSize)
+    {
+        uint64_t sum = 0;
+        for (uint64_t value = begin; value < end; value++)
+            sum += value;
+        return sum;
+    }
+
+    const uint64_t middle = begin + (end - begin) / 2;
+
+    const TaskId leftId  = threadPool->AddTask(true, SumRange, threadPool, begin, middle);
+    const TaskId rightId = threadPool->AddTask(true, SumRange, threadPool, middle, end);
+
+    // Волокно приостанавливается, поток выполняет другие задания.
+    threadPool->Wait(leftId);
+    threadPool->Wait(rightId);
+
+    return threadPool->GetTaskResult<uint64_t>(leftId) + threadPool->GetTaskResult<uint64_t>(rightId);
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+static void ThrowAfterWait(ThreadPool* const threadPool)
+{
+    // Исключение выбрасывается после того, как волокно было приостановлено и продолжено.
+    const TaskId childId = threadPool->AddTask(true, SumRange, threadPool, 0, LeafSize);
+    threadPool->Wait(childId);
+    threadPool->GetTaskResult<uint64_t>(childId);
+
+    throw std::runtime_error("ThrowAfterWait failed");
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
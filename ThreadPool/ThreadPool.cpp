@@ -1,13 +1,14 @@
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
 // Модуль ThreadPool.
-// 
-// Версия: 1.0.0.1
-// Дата последнего изменения: 30.03.2023
-// 
+//
+// Версия: 1.6.0.0
+// Дата последнего изменения: 19.10.2026
+//
 // Автор: Маслов А.С. (https://github.com/ArtemMaslov).
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
 
 #include <iostream>
+#include <algorithm>
 
 #include "ThreadPool.h"
 
@@ -16,22 +17,41 @@ using namespace ThreadPoolModule;
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
 
-TaskId   TaskBase::UniqueId      = 0;
-ThreadId ThreadHandler::UniqueId = 0;
+std::atomic<TaskId>   TaskBase::UniqueId      = 0;
+std::atomic<ThreadId> ThreadHandler::UniqueId = 0;
+
+thread_local ThreadHandler* ThreadHandler::CurrentHandler = nullptr;
+
+/// Минимальный интервал проверки почтовых ящиков при ожидании кражи задания.
+static const std::chrono::microseconds MinStealPollInterval(50);
 
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
 
-TaskBase::TaskBase() :
-    Id(UniqueId++)
+TaskBase::TaskBase(const TaskId id) :
+    Id(id)
+{
+}
+
+TrackedTaskBase::TrackedTaskBase(const TaskId id) :
+    TaskBase(id)
+{
+}
+
+TaskId TaskBase::GenerateId()
 {
+    return UniqueId.fetch_add(1, std::memory_order_relaxed);
 }
 
-ThreadHandler::ThreadHandler(ThreadPoolBase& holder) :
-    Id(UniqueId++),
+ThreadHandler::ThreadHandler(ThreadPoolBase& holder, const size_t index, const bool hasOwnThread) :
+    Id(UniqueId.fetch_add(1, std::memory_order_relaxed)),
+    Index(index),
     Holder(holder),
-    Thread(&ThreadHandler::OnRunningThread, this)
+    Thread()
 {
+    if (hasOwnThread)
+        Thread = std::thread(&ThreadHandler::OnRunningThread, this);
+
     THREAD_POOL_PRINTF("Thread #%zd is constructed\n", Id);
 }
 
@@ -41,253 +61,594 @@ ThreadHandler::~ThreadHandler()
     if (!Holder.IsTerminating)
     {
         Holder.IsTerminating = true;
-        Holder.NotifyThread.notify_all();
+        Holder.WakeAllHandlers();
     }
 
     // Перед вызовом деструктора потока вызываем join(), если он ещё не был вызван.
     // Иначе программа будет завершена через terminate().
     if (Thread.joinable())
         Thread.join();
-    
+
     THREAD_POOL_PRINTF("Thread #%zd is destructed\n", Id);
 }
 
+void ThreadHandler::OnRunningThread()
+{
+    THREAD_POOL_PRINTF("Thread #%zd is running\n", Id);
+
+    CurrentHandler = this;
+    Holder.OnRunningThread(*this);
+    CurrentHandler = nullptr;
+
+    THREAD_POOL_PRINTF("Thread #%zd is stopped\n", Id);
+}
+
+size_t ThreadHandler::GetDoneTasksCount() const
+{
+    return DoneTasksCount.load(std::memory_order_relaxed);
+}
+
+void ThreadHandler::IncDoneTasksCount()
+{
+    // Счётчик изменяется только этим потоком, атомарное сложение не требуется.
+    DoneTasksCount.store(DoneTasksCount.load(std::memory_order_relaxed) + 1,
+                         std::memory_order_relaxed);
+}
+
+size_t ThreadHandler::GetIndex() const
+{
+    return Index;
+}
+
+ThreadHandler* ThreadHandler::GetCurrent()
+{
+    return CurrentHandler;
+}
+
+ThreadPoolBase& ThreadHandler::GetHolder() const
+{
+    return Holder;
+}
+
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
 
-TaskBase* const ThreadPoolBase::GetTaskForHandler()
+void WorkerMailbox::Push(TaskBase* const task, const std::chrono::steady_clock::time_point pushTime)
+{
+    std::unique_lock<std::mutex> lock(MailboxAccess);
+    Entries.push_back({ task, pushTime });
+    EntriesCount.fetch_add(1);
+}
+
+TaskBase* WorkerMailbox::TryPop()
 {
-    // Удаляем задачу из очереди и добавляем её в таблицу завершённых/выполняемых задач.
-    TaskBase* const task = TasksQueue.front();
-    TasksQueue.pop_front();
+    if (IsEmpty())
+        return nullptr;
 
-    TasksInProgress.insert(std::pair<TaskId, TaskBase*>(task->Id, task));
+    std::unique_lock<std::mutex> lock(MailboxAccess);
+    if (Entries.empty())
+        return nullptr;
 
+    TaskBase* const task = Entries.front().Task;
+    Entries.pop_front();
+    EntriesCount.fetch_sub(1, std::memory_order_relaxed);
     return task;
 }
 
+TaskBase* WorkerMailbox::TrySteal(const std::chrono::steady_clock::time_point stealBefore)
+{
+    if (IsEmpty())
+        return nullptr;
+
+    std::unique_lock<std::mutex> lock(MailboxAccess);
+    // Задания добавляются по порядку, поэтому если первое задание ещё нельзя забрать,
+    // то и остальные тоже.
+    if (Entries.empty() || Entries.front().PushTime > stealBefore)
+        return nullptr;
+
+    TaskBase* const task = Entries.front().Task;
+    Entries.pop_front();
+    EntriesCount.fetch_sub(1, std::memory_order_relaxed);
+    return task;
+}
+
+bool WorkerMailbox::IsEmpty() const
+{
+    return EntriesCount.load() == 0;
+}
+
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
 
-void ThreadHandler::OnRunningThread()
+ThreadPoolBase::ThreadPoolBase() :
+    IsTerminating(false),
+    IdleHandlers(),
+    Handlers()
 {
-    THREAD_POOL_PRINTF("Thread #%zd is running\n", Id);
+}
 
-    while (!Holder.IsTerminating)
-    {
-        TaskBase* taskToDo = nullptr;
-        {
-            std::unique_lock<std::mutex> lock(Holder.ThreadPoolBaseAccess);
-            
-            // Ожидаем появления задач в очереди или завершения работы ThreadPool.
-            while (Holder.TasksQueue.empty() && !Holder.NotifyThreadFlag && !Holder.IsTerminating)
-                Holder.NotifyThread.wait(lock);
-            
-            if (Holder.IsTerminating)
-                break;
-
-            // Получаем задачу для выполнения.
-            taskToDo = Holder.GetTaskForHandler();
-            Holder.NotifyThreadFlag = false;
-        }
+ThreadPoolBase::~ThreadPoolBase()
+{
+    // Наследник уже должен был завершить потоки в StopThreads().
+    Handlers.clear();
 
-        // Выполняем задачу.
-        THREAD_POOL_PRINTF("Thread #%zd is starting task %zd\n", Id, taskToDo->Id);
-        taskToDo->Execute();
-        THREAD_POOL_PRINTF("Thread #%zd have done task %zd\n", Id, taskToDo->Id);
-        
-        {
-            std::unique_lock<std::mutex> lock(Holder.ThreadPoolBaseAccess);
+    // Операции ввода-вывода больше никто не забирает, AsyncFileIo дожидается их завершения.
+    AsyncIo.store(nullptr, std::memory_order_relaxed);
+    AsyncIoOwner.reset();
 
-            if (Holder.IsTerminating)
-                break;
+    Fibers.store(nullptr, std::memory_order_relaxed);
+    FibersOwner.reset();
+}
 
-            taskToDo->IsDone = true;
-            Holder.DoneTasksCount++;
+void ThreadPoolBase::StartThreads(const size_t threadsCount, WorkerArena* const arena)
+{
+    Arena = arena;
 
-            if (Holder.IsWaitingAllDone && Holder.DoneTasksCount == Holder.TasksCount)
-            {
-                // ThreadPool ожидает завершения всех задач, уведомляем его, что все задачи выполнены.
-                Holder.IsWaitingAllDone = false;
-                Holder.NotifyAllTasksDoneFlag = true;
-                Holder.NotifyAllDone.notify_all();
-            }
+    IdleHandlers.reserve(threadsCount);
+    // Почтовые ящики создаются до потоков, которые к ним обращаются.
+    for (size_t st = 0; st < threadsCount; st++)
+        Mailboxes.emplace_back();
+    for (size_t st = 0; st < threadsCount; st++)
+        Handlers.emplace_back(*this, st, arena == nullptr);
 
-            if (!taskToDo->IsWaitable)
-            {
-                // Результат задания никто не будет ожидать и получать, освобождаем ресурсы.
-                auto elemIter = Holder.TasksInProgress.erase(taskToDo->Id);
-                delete taskToDo;
-            }
-            else if (taskToDo->IsWaiting)
-            {
-                // Результат задания ожидает ThreadPool, уведомляем его, что задание готово.
-                Holder.NotifyOneTaskDoneFlag = true;
-                Holder.NotifyOneTaskDone.notify_all();
-            }
+    if (arena != nullptr)
+    {
+        // Обработчики ожидают работы в списке спящих, не занимая потоков WorkerArena.
+        std::unique_lock<std::mutex> lock(IdleHandlersAccess);
+        for (ThreadHandler& handler: Handlers)
+        {
+            handler.IsParkedInArena.store(true, std::memory_order_relaxed);
+            IdleHandlers.push_back(&handler);
         }
+        IdleHandlersCount.store(Handlers.size());
     }
+}
 
-    THREAD_POOL_PRINTF("Thread #%zd is stopped\n", Id);
+void ThreadPoolBase::StopThreads()
+{
+    IsTerminating = true;
+    WakeAllHandlers();
+
+    // Обработчики без собственных потоков завершаются в потоках WorkerArena.
+    if (Arena != nullptr)
+        Arena->WaitHandlersStopped(*this);
+
+    // В ThreadHandler вызывается std::thread.join().
+    Handlers.clear();
 }
 
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
 
-ThreadPool::ThreadPool(const size_t threadsCount) :
-    Handlers()
+void ThreadPoolBase::OnTaskAdded()
 {
-    IsTerminating = false;
-    // В случае исключения созданные потоки будут корректно освобождены.
-    Handlers.reserve(threadsCount);
-    for (size_t st = 0; st < threadsCount; st++)
-        Handlers.emplace_back(*this);
+    OutstandingTasksCount.fetch_add(1, std::memory_order_relaxed);
 }
 
-ThreadPool::~ThreadPool()
+void ThreadPoolBase::OnTaskFinished()
 {
-    std::unique_lock<std::mutex> lock(ThreadPoolBaseAccess);
+    if (OutstandingTasksCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        // Все задачи выполнены, будим потоки, ожидающие в WaitAll().
+        OutstandingTasksCount.notify_all();
+    }
+}
 
-    IsTerminating = true;
-    NotifyThread.notify_all();
-    // В ThreadHandler вызывается std::thread.join().
+void ThreadPoolBase::WaitAll()
+{
+    // Если все задачи были выполнены, то ожидание не требуется.
+    size_t outstandingCount = OutstandingTasksCount.load(std::memory_order_acquire);
+    while (outstandingCount != 0)
+    {
+        OutstandingTasksCount.wait(outstandingCount, std::memory_order_acquire);
+        outstandingCount = OutstandingTasksCount.load(std::memory_order_acquire);
+    }
+}
+
+size_t ThreadPoolBase::GetDoneTasksCount() const
+{
+    size_t doneCount = 0;
+    for (const ThreadHandler& handler: Handlers)
+        doneCount += handler.GetDoneTasksCount();
+    return doneCount;
+}
+
+size_t ThreadPoolBase::GetThreadsCount() const
+{
+    return Handlers.size();
+}
+
+void ThreadPoolBase::EnableAffinityStealing(const std::chrono::microseconds delay)
+{
+    const std::chrono::nanoseconds delayNs(delay);
+    AffinityStealDelay.store(delayNs.count(), std::memory_order_relaxed);
+}
 
-    // Очищаем все задачи, так как пользователь не сможет получить к ним доступ.
-    for (std::pair<TaskId, TaskBase*> elem: TasksInProgress)
+void ThreadPoolBase::DisableAffinityStealing()
+{
+    AffinityStealDelay.store(-1, std::memory_order_relaxed);
+}
+
+AsyncFileIo& ThreadPoolBase::EnableAsyncIo(const AsyncIoSettings& settings)
+{
+    THREAD_POOL_ASSERT("Async I/O is already enabled", AsyncIoOwner == nullptr);
+
+    AsyncIoOwner = std::make_unique<AsyncFileIo>(*this, settings);
+    AsyncIo.store(AsyncIoOwner.get(), std::memory_order_release);
+
+    return *AsyncIoOwner;
+}
+
+AsyncFileIo& ThreadPoolBase::GetAsyncIo()
+{
+    THREAD_POOL_ASSERT("Async I/O is not enabled", AsyncIoOwner != nullptr);
+
+    return *AsyncIoOwner;
+}
+
+FiberRuntime& ThreadPoolBase::EnableFibers(const FiberSettings& settings)
+{
+    THREAD_POOL_ASSERT("Fibers are already enabled", FibersOwner == nullptr);
+
+    FibersOwner = std::make_unique<FiberRuntime>(*this, settings);
+    Fibers.store(FibersOwner.get(), std::memory_order_release);
+
+    return *FibersOwner;
+}
+
+FiberRuntime& ThreadPoolBase::GetFibers()
+{
+    THREAD_POOL_ASSERT("Fibers are not enabled", FibersOwner != nullptr);
+
+    return *FibersOwner;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+void ThreadPoolBase::WakeOneHandler()
+{
+    // Парный барьер находится в ParkHandler().
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // Все потоки заняты, мьютекс не захватываем.
+    if (IdleHandlersCount.load(std::memory_order_relaxed) == 0)
+        return;
+
+    ThreadHandler* handler = nullptr;
     {
-        delete elem.second;
+        std::unique_lock<std::mutex> lock(IdleHandlersAccess);
+        if (IdleHandlers.empty())
+            return;
+
+        handler = IdleHandlers.back();
+        IdleHandlers.pop_back();
+        IdleHandlersCount.fetch_sub(1, std::memory_order_relaxed);
     }
-    TasksInProgress.clear();
 
-    size_t queueCount = TasksQueue.size();
-    for (size_t st = 0; st < queueCount; st++)
+    SignalHandler(*handler);
+}
+
+void ThreadPoolBase::WakeAllHandlers()
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    std::unique_lock<std::mutex> lock(IdleHandlersAccess);
+    for (ThreadHandler* const handler: IdleHandlers)
+        SignalHandler(*handler);
+
+    IdleHandlers.clear();
+    IdleHandlersCount.store(0, std::memory_order_relaxed);
+}
+
+bool ThreadPoolBase::WakeHandler(ThreadHandler& handler)
+{
+    // Парный барьер находится в ParkHandler().
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (IdleHandlersCount.load(std::memory_order_relaxed) == 0)
+        return false;
+
+    if (!RemoveIdleHandler(handler))
+        return false;
+
+    SignalHandler(handler);
+    return true;
+}
+
+bool ThreadPoolBase::RemoveIdleHandler(ThreadHandler& handler)
+{
+    std::unique_lock<std::mutex> lock(IdleHandlersAccess);
+
+    auto elemIter = std::find(IdleHandlers.begin(), IdleHandlers.end(), &handler);
+    if (elemIter == IdleHandlers.end())
+        return false;
+
+    IdleHandlers.erase(elemIter);
+    IdleHandlersCount.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+void ThreadPoolBase::SignalHandler(ThreadHandler& handler)
+{
+    // Парная проверка находится в ParkHandler().
+    handler.WakeSignal.fetch_add(1);
+    handler.WakeSignal.notify_one();
+
+    if (CompletionsWaiter.load() == &handler)
+        AsyncIo.load(std::memory_order_acquire)->WakeWaiter();
+
+    // Обработчик вернул поток в WorkerArena, добавляем его в очередь на выполнение.
+    // Если флаг ещё не установлен, то сигнал заметит поток WorkerArena.
+    if (Arena != nullptr)
     {
-        TaskBase* const task = TasksQueue.back();
-        TasksQueue.pop_back();
-        delete task;
+        bool isParked = true;
+        if (handler.IsParkedInArena.compare_exchange_strong(isParked, false))
+            Arena->Schedule(handler);
     }
 }
 
+void ThreadPoolBase::OnAsyncIoSubmitted()
+{
+    // Ожидающий завершения операций поток заметит и эту операцию. Иначе будим поток, который
+    // станет ожидающим.
+    if (CompletionsWaiter.load() == nullptr)
+        WakeOneHandler();
+}
+
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
 
-void ThreadPool::Wait(TaskId id)
+void ThreadPoolBase::PushToMailbox(const size_t handlerIndex, TaskBase* const task)
 {
-    {
-        std::unique_lock<std::mutex> lock(ThreadPoolBaseAccess);
+    const int64_t stealDelay = AffinityStealDelay.load(std::memory_order_relaxed);
 
-        // Пытаемся найти задачу среди выполненных или выполняемых.
-        auto elemIter = TasksInProgress.find(id);
+    // Время добавления записывается и при выключенной краже: иначе задания, добавленные до
+    // EnableAffinityStealing(), можно было бы забрать сразу, без задержки.
+    Mailboxes[handlerIndex].Push(task, std::chrono::steady_clock::now());
+    MailboxTasksCount.fetch_add(1);
 
-        if (elemIter != TasksInProgress.end())
-        {
-            // Задание найдено.
-            TaskBase* const task = elemIter->second;
-            // Задание было завершено, ожидание не нужно.
-            if (task->IsDone)
-                return;
+    // Если поток занят, то он заберёт задание после выполнения текущего. При включённой
+    // краже будим другой поток, чтобы он забрал задание, если поток-адресат долго занят.
+    if (!WakeHandler(Handlers[handlerIndex]) && stealDelay >= 0)
+        WakeOneHandler();
+}
 
-            // Попытка ожидания задания, которое нельзя ожидать => ошибка.
-            THREAD_POOL_ASSERT("Attempt to wait for not waitable task",
-                               task->IsWaitable == true);
-            task->IsWaiting = true;
-            // Задание ещё выполняется, ожидаем его завершения.
-        }
-        else
+TaskBase* ThreadPoolBase::TryPopMailbox(const size_t handlerIndex)
+{
+    TaskBase* const task = Mailboxes[handlerIndex].TryPop();
+    if (task != nullptr)
+        MailboxTasksCount.fetch_sub(1, std::memory_order_relaxed);
+    return task;
+}
+
+TaskBase* ThreadPoolBase::TryStealMailbox(ThreadHandler& thief)
+{
+    const int64_t stealDelay = AffinityStealDelay.load(std::memory_order_relaxed);
+    if (stealDelay < 0 || MailboxTasksCount.load(std::memory_order_relaxed) == 0)
+        return nullptr;
+
+    const std::chrono::steady_clock::time_point stealBefore =
+        std::chrono::steady_clock::now() - std::chrono::nanoseconds(stealDelay);
+
+    const size_t mailboxesCount = Mailboxes.size();
+    for (size_t st = 1; st < mailboxesCount; st++)
+    {
+        const size_t  index = (thief.GetIndex() + st) % mailboxesCount;
+        TaskBase* const task = Mailboxes[index].TrySteal(stealBefore);
+        if (task != nullptr)
         {
-            TaskBase* task = nullptr;
-            // Задание не найдено среди выполняющихся, ищем его в очереди на выполнение.
-            for (TaskBase* elem: TasksQueue)
-            {
-                if (elem->Id == id)
-                {
-                    task = elem;
-                    break;
-                }
-            }
-            // Попытка ожидания не существующего задания => ошибка.
-            THREAD_POOL_ASSERT("Attempt to wait for not existing task",
-                               task != nullptr);
-            
-            // Попытка ожидания задания, которое нельзя ожидать => ошибка.
-            THREAD_POOL_ASSERT("Attempt to wait for not waitable task",
-                               task->IsWaitable == true);
-            task->IsWaiting = true;
-            // Ожидаем выполнения задания.
+            THREAD_POOL_PRINTF("Thread #%zd steals task %zd from thread #%zd\n",
+                               thief.GetIndex(), task->Id, index);
+            MailboxTasksCount.fetch_sub(1, std::memory_order_relaxed);
+            return task;
         }
     }
 
-    while (true)
-    {
-        std::unique_lock<std::mutex> lock(ThreadPoolBaseAccess);
+    return nullptr;
+}
 
-        while (!NotifyOneTaskDoneFlag)
-            NotifyOneTaskDone.wait(lock);
-        NotifyOneTaskDoneFlag = false;
+bool ThreadPoolBase::HasMailboxTasks(ThreadHandler& handler) const
+{
+    return !Mailboxes[handler.GetIndex()].IsEmpty();
+}
 
-        auto elemIter = TasksInProgress.find(id);
-        // Было выполнено не наше задание (его ожидал другой поток).
-        if (elemIter == TasksInProgress.end())
-            continue;
+bool ThreadPoolBase::WaitForStealableTasks()
+{
+    const int64_t stealDelay = AffinityStealDelay.load(std::memory_order_relaxed);
+    if (stealDelay < 0 || MailboxTasksCount.load(std::memory_order_relaxed) == 0)
+        return false;
+
+    // Проверяем почтовые ящики с шагом в четверть времени кражи.
+    const std::chrono::nanoseconds pollInterval =
+        std::max<std::chrono::nanoseconds>(std::chrono::nanoseconds(stealDelay / 4),
+                                           MinStealPollInterval);
+    std::this_thread::sleep_for(pollInterval);
+    return true;
+}
 
-        // Ожидаемое задание было выполнено, возвращаемся из функции Wait().
-        if (elemIter->second->IsDone)
-            break;
-    }
+bool ThreadPoolBase::YieldToArena(ThreadHandler& handler)
+{
+    if (Arena == nullptr || !Arena->HasWaitingHandlers())
+        return false;
+
+    // Поток WorkerArena добавит обработчик в очередь после завершения цикла.
+    handler.ArenaExitReason = ThreadHandler::ArenaExit::Yielded;
+    return true;
 }
 
-void ThreadPool::WaitAll()
+size_t ThreadPoolBase::PollCompletions(ThreadHandler& handler)
 {
-    std::unique_lock<std::mutex> lock(ThreadPoolBaseAccess);
+    AsyncFileIo* const asyncIo = AsyncIo.load(std::memory_order_acquire);
+    if (asyncIo == nullptr)
+        return 0;
 
-    // Если все задачи были выполнены, то ожидание не требуется.
-    if (TasksCount == DoneTasksCount)
-        return;
+    return asyncIo->PollCompletions(handler);
+}
+
+bool ThreadPoolBase::UsesFibers() const
+{
+    return Fibers.load(std::memory_order_acquire) != nullptr;
+}
+
+void ThreadPoolBase::RunTaskOnFiber(ThreadHandler& handler, TaskBase* const task)
+{
+    Fibers.load(std::memory_order_acquire)->RunTask(handler, task);
+}
 
-    IsWaitingAllDone = true;
+bool ThreadPoolBase::ResumeReadyFiber(ThreadHandler& handler)
+{
+    FiberRuntime* const fibers = Fibers.load(std::memory_order_acquire);
+    if (fibers == nullptr)
+        return false;
+
+    return fibers->ResumeReadyFiber(handler);
+}
 
-    while (!NotifyAllTasksDoneFlag)
-        NotifyAllDone.wait(lock);
-    NotifyAllTasksDoneFlag = false;
+bool ThreadPoolBase::HasReadyFibers(ThreadHandler& handler) const
+{
+    FiberRuntime* const fibers = Fibers.load(std::memory_order_acquire);
+    return fibers != nullptr && fibers->HasReadyFibers(handler);
+}
+
+std::vector<TaskBase*> ThreadPoolBase::ExtractSuspendedFiberTasks()
+{
+    FiberRuntime* const fibers = Fibers.load(std::memory_order_acquire);
+    if (fibers == nullptr)
+        return std::vector<TaskBase*>();
+
+    return fibers->ExtractSuspendedTasks();
 }
 
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
 
-template <>
-void ThreadPool::GetTaskResult<void>(TaskId id)
+WorkerArena::WorkerArena(const size_t threadsCount)
 {
-    THREAD_POOL_PRINTF("ThreadPool: find task #%zd\n", id);
+    size_t arenaThreadsCount = threadsCount;
+    if (arenaThreadsCount == 0)
+        arenaThreadsCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
 
-    auto elemIter = TasksInProgress.find(id);
-    // Задание не найдено.
-    THREAD_POOL_ASSERT("Attempt to get result of not existing task",
-                       elemIter != TasksInProgress.end());
-    
-    Task<void>* task = static_cast<Task<void>*>(elemIter->second);
-    
-    // Задание ещё не выполнено.
-    THREAD_POOL_ASSERT("Task have not done yet",
-                       task->IsDone);
+    try
+    {
+        for (size_t st = 0; st < arenaThreadsCount; st++)
+            Threads.emplace_back(&WorkerArena::OnRunningThread, this);
+    }
+    catch (...)
+    {
+        // В случае исключения созданные потоки будут корректно завершены.
+        {
+            std::unique_lock<std::mutex> lock(ArenaAccess);
+            IsTerminating = true;
+        }
+        HandlersCondition.notify_all();
+        for (std::thread& thread: Threads)
+            thread.join();
+        throw;
+    }
+}
+
+WorkerArena::~WorkerArena()
+{
+    {
+        std::unique_lock<std::mutex> lock(ArenaAccess);
+        THREAD_POOL_ASSERT("WorkerArena is destroyed while ThreadPool is using it",
+                           ReadyHandlers.empty());
+        IsTerminating = true;
+    }
+    HandlersCondition.notify_all();
 
-    // Освобождаем ресурсы, занимаемые заданием.
-    delete task;
-    TasksInProgress.erase(elemIter);
+    for (std::thread& thread: Threads)
+        thread.join();
 }
 
-///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
-///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+WorkerArena& WorkerArena::GetDefault()
+{
+    static WorkerArena DefaultArena;
+    return DefaultArena;
+}
+
+size_t WorkerArena::GetThreadsCount() const
+{
+    return Threads.size();
+}
+
+void WorkerArena::Schedule(ThreadHandler& handler)
+{
+    {
+        std::unique_lock<std::mutex> lock(ArenaAccess);
+        handler.Holder.ArenaActiveHandlersCount++;
+        ReadyHandlers.push_back(&handler);
+        ReadyHandlersCount.store(ReadyHandlers.size(), std::memory_order_relaxed);
+    }
+    HandlersCondition.notify_one();
+}
 
-Task<void>::Task(std::packaged_task<void()>&& packagedTask) :
-        TaskBase(),
-        PackagedTask(std::move(packagedTask))
+bool WorkerArena::HasWaitingHandlers() const
 {
+    return ReadyHandlersCount.load(std::memory_order_relaxed) != 0;
 }
 
-void Task<void>::Execute()
+void WorkerArena::WaitHandlersStopped(ThreadPoolBase& pool)
 {
-    PackagedTask();
+    std::unique_lock<std::mutex> lock(ArenaAccess);
+    StoppedCondition.wait(lock, [&pool]()
+    {
+        return pool.ArenaActiveHandlersCount == 0;
+    });
 }
 
+void WorkerArena::OnRunningThread()
+{
+    while (true)
+    {
+        ThreadHandler* handler = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(ArenaAccess);
+            HandlersCondition.wait(lock, [this]()
+            {
+                return IsTerminating || !ReadyHandlers.empty();
+            });
+
+            if (ReadyHandlers.empty())
+                return;
+
+            handler = ReadyHandlers.front();
+            ReadyHandlers.pop_front();
+            ReadyHandlersCount.store(ReadyHandlers.size(), std::memory_order_relaxed);
+        }
+
+        // Обработчик выполняется, пока у ThreadPool есть работа.
+        handler->ArenaExitReason = ThreadHandler::ArenaExit::Stopped;
+        handler->OnRunningThread();
+
+        // Обработчик завершил цикл, только теперь его можно передать другому потоку.
+        bool isReady = handler->ArenaExitReason == ThreadHandler::ArenaExit::Yielded;
+        if (handler->ArenaExitReason == ThreadHandler::ArenaExit::Parked)
+        {
+            // После установки флага обработчик может выполняться другим потоком.
+            const uint32_t wakeSignal = handler->ParkedWakeSignal;
+            handler->IsParkedInArena.store(true);
+
+            // SignalHandler() сначала изменяет WakeSignal, затем проверяет флаг. Мы делаем
+            // наоборот, поэтому сигнал, пришедший до установки флага, будет замечен здесь.
+            if (handler->WakeSignal.load() != wakeSignal)
+            {
+                bool isParked = true;
+                isReady = handler->IsParkedInArena.compare_exchange_strong(isParked, false);
+            }
+        }
+
+        if (isReady)
+            Schedule(*handler);
+
+        // ThreadPool ожидает в StopThreads() под тем же мьютексом, поэтому не может быть
+        // уничтожен, пока счётчик не уменьшен.
+        std::unique_lock<std::mutex> lock(ArenaAccess);
+        handler->Holder.ArenaActiveHandlersCount--;
+        StoppedCondition.notify_all();
+    }
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
-///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
\ No newline at end of file
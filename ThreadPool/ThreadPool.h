@@ -1,40 +1,48 @@
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
 // Модуль ThreadPool.
-// 
-// Версия: 1.0.0.1
-// Дата последнего изменения: 30.03.2023
-// 
+//
+// Версия: 1.6.0.0
+// Дата последнего изменения: 19.10.2026
+//
 // Автор: Маслов А.С. (https://github.com/ArtemMaslov).
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
 
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <condition_variable>
 #include <thread>
 #include <future>
-#include <condition_variable>
-#include <unordered_map>
 #include <vector>
 #include <deque>
+#include <memory>
+
+#ifndef THREAD_POOL_DISABLE_DEBUG
+    #define THREAD_POOL_ENABLE_DEBUG
+#endif
 
-#define THREAD_POOL_ENABLE_DEBUG
+#include "ThreadPoolPolicies.h"
+#include "AsyncFileIo.h"
+#include "Fiber.h"
 
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
 
 namespace ThreadPoolModule
 {
-    typedef size_t TaskId;
-
     /**
      * @brief Абстрактный класс исполняемой в потоке задачи.
-     * 
+     *
      * Является обёрткой для вызываемых объектов: функций, функторов, лямбда-выражений.
     */
     class TaskBase
     {
     public:
-        TaskBase();
+        TaskBase(const TaskId id);
 
         virtual ~TaskBase() = default;
 
@@ -43,29 +51,51 @@ namespace ThreadPoolModule
         */
         virtual void Execute() = 0;
 
+        /**
+         * @brief Получить новый уникальный идентификатор задачи.
+        */
+        static TaskId GenerateId();
+
     public:
-        static TaskId UniqueId;
+        static std::atomic<TaskId> UniqueId;
         /// Уникальный идентификатор задачи.
-        const  TaskId Id;
-        /// Если true, то ThreadPool ожидает завершения выполнения этого задания.
-        bool          IsWaiting  = false;
+        const  TaskId              Id;
+    };
+
+    /**
+     * @brief Задача ThreadPool, хранящего результаты (TrackResultPolicy).
+     *
+     * Поля для ожидания и получения результата не входят в TaskBase, поэтому задания
+     * ThreadPool без таблицы результатов их не содержат.
+    */
+    class TrackedTaskBase : public TaskBase
+    {
+    public:
+        TrackedTaskBase(const TaskId id);
+
+    public:
         /// Если true, то задание было выполнено и можно получить его результат.
-        bool          IsDone     = false;
+        /// Устанавливается потоком-исполнителем без захвата мьютекса ThreadPool.
+        std::atomic<bool>     IsDone     = false;
         /// Если true, то ThreadPool будет хранить результат выполнения задания, пока его не
         /// прочитает пользователь.
-        bool          IsWaitable = true;
+        bool                  IsWaitable = true;
+        /// Количество владельцев ожидаемого задания: таблица результатов и потоки, ожидающие
+        /// его в Wait(). Задание освобождает последний из них.
+        std::atomic<uint32_t> RefsCount  = 1;
     };
 
     /**
-     * @brief Класс исполняемой в потоке задачи.
-     * 
+     * @brief Класс исполняемой в потоке задачи, результат которой можно получить.
+     *
      * @tparam RetType Тип возвращаемого функцией значения.
     */
     template <typename RetType>
-    class Task : public TaskBase
+    class Task : public TrackedTaskBase
     {
     public:
-        Task(std::packaged_task<RetType()>&& packagedTask);
+        template <typename Callable>
+        Task(const TaskId id, Callable&& callable);
 
         virtual ~Task() = default;
 
@@ -77,7 +107,7 @@ namespace ThreadPoolModule
         /**
          * @brief Получить результат выполнения задачи.
          * После этого объект ресурсы Task будут освобождены.
-         * 
+         *
          * @return Результат выполнения задачи.
          */
         RetType GetResult();
@@ -89,13 +119,21 @@ namespace ThreadPoolModule
         std::future<RetType> Result;
     };
 
-    template <>
-    class Task<void> : public TaskBase
+    /**
+     * @brief Класс исполняемой в потоке задачи, результат которой не сохраняется.
+     *
+     * В отличие от Task не создаёт std::packaged_task и разделяемое состояние std::future.
+     *
+     * @tparam Callable Тип вызываемого объекта.
+     * @tparam BaseType Базовый класс заданий ThreadPool: TaskBase или TrackedTaskBase.
+    */
+    template <typename Callable, typename BaseType = TaskBase>
+    class CallableTask : public BaseType
     {
     public:
-        Task(std::packaged_task<void()>&& packagedTask);
+        CallableTask(const TaskId id, Callable&& callable);
 
-        virtual ~Task() = default;
+        virtual ~CallableTask() = default;
 
         /**
          * @brief Выполнить задачу.
@@ -104,7 +142,7 @@ namespace ThreadPoolModule
 
     private:
         /// Оборачиваемая задача: функция / функтор / лямбда-выражение.
-        std::packaged_task<void()> PackagedTask;
+        Callable Funct;
     };
 
     ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
@@ -113,95 +151,681 @@ namespace ThreadPoolModule
     typedef size_t ThreadId;
 
     class ThreadPoolBase;
+    class WorkerArena;
 
+    /**
+     * @brief Поток ThreadPool.
+     *
+     * Если ThreadPool использует общий набор потоков (WorkerArena), то обработчик не создаёт
+     * собственный поток: он выполняется потоками WorkerArena, пока у ThreadPool есть работа.
+    */
     class ThreadHandler
     {
+        friend class ThreadPoolBase;
+        friend class WorkerArena;
     public:
-        ThreadHandler(ThreadPoolBase& holder);
+        /**
+         * @param hasOwnThread Если false, то обработчик выполняется потоками WorkerArena.
+        */
+        ThreadHandler(ThreadPoolBase& holder, const size_t index, const bool hasOwnThread);
 
-        ThreadHandler(ThreadHandler&& that) = default;
+        ThreadHandler(const ThreadHandler& that) = delete;
+        ThreadHandler& operator = (const ThreadHandler& that) = delete;
 
         ~ThreadHandler();
 
         void OnRunningThread();
 
+        /**
+         * @brief Получить количество заданий, выполненных этим потоком.
+        */
+        size_t GetDoneTasksCount() const;
+
+        /**
+         * @brief Увеличить счётчик выполненных заданий. Вызывается только из потока обработчика.
+        */
+        void IncDoneTasksCount();
+
+        /**
+         * @brief Получить номер потока в ThreadPool.
+        */
+        size_t GetIndex() const;
+
+        /**
+         * @brief Получить обработчик, в потоке которого выполняется вызов.
+         *
+         * @return Обработчик или nullptr, если вызов выполняется не потоком ThreadPool.
+        */
+        static ThreadHandler* GetCurrent();
+
+        /**
+         * @brief Получить ThreadPool, которому принадлежит поток.
+        */
+        ThreadPoolBase& GetHolder() const;
+
     private:
-        static ThreadId UniqueId;
-        const  ThreadId Id;
+        /// Причина, по которой обработчик без собственного потока завершил цикл.
+        enum class ArenaExit
+        {
+            /// ThreadPool завершает работу.
+            Stopped,
+            /// Нет работы, обработчик в списке спящих.
+            Parked,
+            /// Обработчик уступил поток другим обработчикам WorkerArena.
+            Yielded
+        };
+
+        /// Обработчик текущего потока.
+        static thread_local ThreadHandler* CurrentHandler;
+
+        static std::atomic<ThreadId> UniqueId;
+        const  ThreadId              Id;
+        /// Номер потока в ThreadPool, от 0 до количества потоков.
+        const  size_t                Index;
 
         ThreadPoolBase& Holder;
+        /// Количество выполненных потоком заданий. Изменяется только этим потоком, а читается
+        /// по запросу пользователя, поэтому вынесено в отдельную кэш-линию.
+        alignas(CacheLineSize) std::atomic<size_t> DoneTasksCount = 0;
+        /// Сигнал пробуждения. Спящий поток ожидает изменения значения.
+        alignas(CacheLineSize) std::atomic<uint32_t> WakeSignal = 0;
+        /// Обработчик без собственного потока вернул поток в WorkerArena и ожидает, пока его
+        /// снова добавят в очередь WorkerArena. Устанавливается потоком WorkerArena после
+        /// завершения цикла обработчика, чтобы обработчик не выполнялся двумя потоками.
+        std::atomic<bool> IsParkedInArena = false;
+        /// Записываются обработчиком перед завершением цикла и читаются тем же потоком WorkerArena.
+        ArenaExit ArenaExitReason  = ArenaExit::Stopped;
+        /// Значение WakeSignal, с которым обработчик вернул поток в WorkerArena.
+        uint32_t  ParkedWakeSignal = 0;
+        /// Поток должен создаваться последним, так как использует остальные поля.
         std::thread     Thread;
     };
 
     ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
     ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
 
+    /**
+     * @brief Очередь заданий, адресованных конкретному потоку (AddTaskOn, AddTaskForKey).
+     *
+     * Поток-владелец забирает задания из начала очереди раньше, чем из общей очереди.
+     * Другие потоки могут забрать задание, только если оно ожидает дольше заданного времени.
+    */
+    class WorkerMailbox
+    {
+    public:
+        /**
+         * @brief Добавить задание в конец очереди.
+         *
+         * @param pushTime Время добавления, используется для кражи задания другими потоками.
+        */
+        void Push(TaskBase* const task, const std::chrono::steady_clock::time_point pushTime);
+
+        /**
+         * @brief Извлечь задание из начала очереди.
+         *
+         * @return Задание или nullptr, если очередь пуста.
+        */
+        TaskBase* TryPop();
+
+        /**
+         * @brief Извлечь задание из начала очереди, если оно добавлено не позже stealBefore.
+         *
+         * @return Задание или nullptr.
+        */
+        TaskBase* TrySteal(const std::chrono::steady_clock::time_point stealBefore);
+
+        /**
+         * @brief Проверить, пуста ли очередь. Не захватывает мьютекс.
+        */
+        bool IsEmpty() const;
+
+    private:
+        struct Entry
+        {
+            TaskBase*                             Task;
+            std::chrono::steady_clock::time_point PushTime;
+        };
+
+        /// Контроль над доступом к очереди.
+        std::mutex        MailboxAccess;
+        /// Задания в порядке добавления.
+        std::deque<Entry> Entries;
+        /// Количество заданий. Позволяет проверять очередь без захвата мьютекса.
+        std::atomic<size_t> EntriesCount = 0;
+    };
+
+    ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+    ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+    /**
+     * @brief Общий набор потоков для нескольких ThreadPool.
+     *
+     * Каждый ThreadPool, созданный на WorkerArena, сохраняет свои очереди и WaitAll(), но не
+     * создаёт потоков: его обработчики выполняются потоками WorkerArena, пока у ThreadPool есть
+     * работа. Количество обработчиков ThreadPool (доля) ограничивает число потоков WorkerArena,
+     * одновременно выполняющих его задания. Поэтому общее количество потоков процесса не
+     * превышает размер WorkerArena, сколько бы ThreadPool ни было создано.
+     *
+     * Обработчик, выполнивший подряд много заданий, уступает поток другим ThreadPool, если
+     * их обработчики ожидают в очереди WorkerArena.
+    */
+    class WorkerArena
+    {
+        friend class ThreadPoolBase;
+    public:
+        /**
+         * @param threadsCount Количество потоков. Если 0, то std::thread::hardware_concurrency().
+        */
+        WorkerArena(const size_t threadsCount = 0);
+
+        WorkerArena(const WorkerArena&)            = delete;
+        WorkerArena& operator=(const WorkerArena&) = delete;
+
+        /**
+         * @brief Завершает потоки. Все ThreadPool, использующие WorkerArena, должны быть
+         * уничтожены раньше.
+        */
+        ~WorkerArena();
+
+        /**
+         * @brief Получить общий для процесса набор потоков по числу ядер.
+        */
+        static WorkerArena& GetDefault();
+
+        /**
+         * @brief Получить количество потоков.
+        */
+        size_t GetThreadsCount() const;
+
+    private:
+        /**
+         * @brief Добавить обработчик в очередь на выполнение.
+        */
+        void Schedule(ThreadHandler& handler);
+
+        /**
+         * @brief Проверить, ожидают ли обработчики свободного потока.
+        */
+        bool HasWaitingHandlers() const;
+
+        /**
+         * @brief Ожидать, пока потоки перестанут выполнять обработчики ThreadPool.
+        */
+        void WaitHandlersStopped(ThreadPoolBase& pool);
+
+        void OnRunningThread();
+
+        /// Контроль над доступом к очереди обработчиков и счётчикам ThreadPool::ArenaActiveHandlersCount.
+        std::mutex                 ArenaAccess;
+        /// Оповещение о появлении обработчиков в очереди.
+        std::condition_variable    HandlersCondition;
+        /// Оповещение о завершении выполнения обработчика.
+        std::condition_variable    StoppedCondition;
+        std::deque<ThreadHandler*> ReadyHandlers;
+        /// Размер ReadyHandlers. Позволяет проверять очередь без захвата мьютекса.
+        std::atomic<size_t>        ReadyHandlersCount = 0;
+        bool                       IsTerminating      = false;
+
+        std::vector<std::thread>   Threads;
+    };
+
+    ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+    ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+    /**
+     * @brief Общая, не зависящая от стратегий часть ThreadPool.
+     *
+     * Владеет потоками, ведёт учёт невыполненных заданий и усыпляет/будит простаивающие потоки.
+    */
     class ThreadPoolBase
     {
         friend class ThreadHandler;
+        friend class AsyncFileIo;
+        friend class WorkerArena;
+        friend class FiberRuntime;
+    public:
+        ThreadPoolBase();
+
+        virtual ~ThreadPoolBase();
+
+        /**
+         * @brief Ожидать завершения выполнения всех заданий.
+        */
+        void WaitAll();
+
+        /**
+         * @brief Получить количество выполненных заданий.
+         *
+         * Счётчики потоков суммируются при каждом вызове, поэтому результат приблизителен,
+         * если задания продолжают выполняться.
+        */
+        size_t GetDoneTasksCount() const;
+
+        /**
+         * @brief Получить количество потоков.
+        */
+        size_t GetThreadsCount() const;
+
+        /**
+         * @brief Разрешить потокам забирать задания из чужих почтовых ящиков.
+         *
+         * Задание, адресованное занятому потоку, может быть выполнено другим потоком, если
+         * оно ожидает в почтовом ящике дольше delay. По умолчанию кража отключена.
+        */
+        void EnableAffinityStealing(const std::chrono::microseconds delay);
+
+        /**
+         * @brief Запретить потокам забирать задания из чужих почтовых ящиков.
+        */
+        void DisableAffinityStealing();
+
+        /**
+         * @brief Получить асинхронный ввод-вывод, включённый EnableAsyncIo().
+        */
+        AsyncFileIo& GetAsyncIo();
+
+        /**
+         * @brief Получить выполнение в волокнах, включённое EnableFibers().
+        */
+        FiberRuntime& GetFibers();
+
     protected:
-        TaskBase* const GetTaskForHandler();
+        /**
+         * @brief Создать AsyncFileIo. Доступно через BasicThreadPool::EnableAsyncIo(), если
+         * ThreadPool поддерживает ввод-вывод.
+        */
+        AsyncFileIo& EnableAsyncIo(const AsyncIoSettings& settings);
+
+        /**
+         * @brief Создать FiberRuntime. Доступно через BasicThreadPool::EnableFibers(), если
+         * ThreadPool поддерживает волокна.
+        */
+        FiberRuntime& EnableFibers(const FiberSettings& settings);
+
+        /**
+         * @brief Цикл потока-исполнителя. Реализуется BasicThreadPool в соответствии со стратегиями.
+        */
+        virtual void OnRunningThread(ThreadHandler& handler) = 0;
+
+        /**
+         * @brief Учесть завершение задания, выполненного в волокне FiberRuntime. Вызывается
+         * в волокне, в том числе если задание выбросило исключение.
+        */
+        virtual void FinishFiberTask(ThreadHandler& handler, TaskBase* const task) = 0;
+
+        /**
+         * @brief Создать потоки. Вызывается из конструктора наследника, когда он полностью создан.
+         *
+         * @param arena Если не nullptr, то создаются threadsCount обработчиков без собственных
+         * потоков, которые выполняются потоками arena.
+        */
+        void StartThreads(const size_t threadsCount, WorkerArena* const arena = nullptr);
+
+        /**
+         * @brief Завершить и присоединить все потоки.
+         * Вызывается из деструктора наследника, пока его поля ещё существуют.
+        */
+        void StopThreads();
+
+        /**
+         * @brief Учесть добавление задания.
+        */
+        void OnTaskAdded();
+
+        /**
+         * @brief Учесть завершение задания. Будит потоки, ожидающие в WaitAll().
+        */
+        void OnTaskFinished();
+
+        /**
+         * @brief Усыпить поток до появления работы.
+         *
+         * Поток регистрируется в списке спящих и повторно проверяет hasWork(), поэтому
+         * задание, добавленное одновременно с засыпанием, не будет пропущено.
+         *
+         * @param hasWork Функция проверки наличия работы для потока.
+         *
+         * @return false, если обработчик вернул поток в WorkerArena и должен завершить цикл.
+        */
+        template <typename HasWorkFunct>
+        bool ParkHandler(ThreadHandler& handler, HasWorkFunct hasWork);
+
+        /**
+         * @brief Уступить поток WorkerArena, если другие обработчики ожидают свободного потока.
+         *
+         * @return true, если обработчик должен завершить цикл. Поток WorkerArena снова добавит
+         * его в очередь.
+        */
+        bool YieldToArena(ThreadHandler& handler);
+
+        /// Количество заданий, после которых обработчик без собственного потока проверяет,
+        /// не нужно ли уступить поток WorkerArena.
+        static constexpr size_t ArenaYieldInterval = 64;
+
+        /**
+         * @brief Разбудить один спящий поток, если такой есть.
+         * Вызывается после добавления задания в очередь.
+        */
+        void WakeOneHandler();
+
+        /**
+         * @brief Разбудить все спящие потоки.
+        */
+        void WakeAllHandlers();
+
+        /**
+         * @brief Разбудить определённый поток, если он спит.
+         *
+         * @return true, если поток спал и был разбужен.
+        */
+        bool WakeHandler(ThreadHandler& handler);
+
+        /**
+         * @brief Добавить задание в почтовый ящик потока и разбудить его.
+        */
+        void PushToMailbox(const size_t handlerIndex, TaskBase* const task);
+
+        /**
+         * @brief Извлечь задание из почтового ящика потока.
+        */
+        TaskBase* TryPopMailbox(const size_t handlerIndex);
+
+        /**
+         * @brief Забрать задание, слишком долго ожидающее в почтовом ящике другого потока.
+        */
+        TaskBase* TryStealMailbox(ThreadHandler& thief);
+
+        /**
+         * @brief Проверить, есть ли задания в почтовом ящике потока.
+        */
+        bool HasMailboxTasks(ThreadHandler& handler) const;
+
+        /**
+         * @brief Подождать, пока задания в чужих почтовых ящиках станут доступны для кражи.
+         *
+         * Спящий поток не замечает, что задание стало доступно для кражи, поэтому при
+         * включённой краже и непустых почтовых ящиках поток не засыпает, а периодически
+         * проверяет их.
+         *
+         * @return true, если поток подождал и нужно снова искать задания; false, если поток
+         * может засыпать.
+        */
+        bool WaitForStealableTasks();
+
+        /**
+         * @brief Выполнить продолжения завершённых операций ввода-вывода.
+         *
+         * @return Количество выполненных продолжений.
+        */
+        size_t PollCompletions(ThreadHandler& handler);
+
+        /**
+         * @brief Проверить, включено ли выполнение заданий в волокнах.
+        */
+        bool UsesFibers() const;
+
+        /**
+         * @brief Выполнить задание в волокне.
+        */
+        void RunTaskOnFiber(ThreadHandler& handler, TaskBase* const task);
+
+        /**
+         * @brief Продолжить одно из волокон потока, дождавшихся своих заданий.
+         *
+         * @return true, если волокно было продолжено.
+        */
+        bool ResumeReadyFiber(ThreadHandler& handler);
+
+        /**
+         * @brief Проверить, есть ли у потока волокна, готовые к продолжению.
+        */
+        bool HasReadyFibers(ThreadHandler& handler) const;
+
+        /**
+         * @brief Забрать задания волокон, приостановленных при завершении потоков.
+        */
+        std::vector<TaskBase*> ExtractSuspendedFiberTasks();
+
+    private:
+        /**
+         * @brief Удалить поток из списка спящих.
+         *
+         * @return true, если поток был в списке.
+        */
+        bool RemoveIdleHandler(ThreadHandler& handler);
+
+        /**
+         * @brief Разбудить поток, уже удалённый из списка спящих.
+         *
+         * Если поток ожидает завершения операций ввода-вывода, то ожидание прерывается.
+        */
+        void SignalHandler(ThreadHandler& handler);
+
+        /**
+         * @brief Вызывается после отправки операции ввода-вывода. Будит поток, если никто
+         * не ожидает завершения операций.
+        */
+        void OnAsyncIoSubmitted();
 
     protected:
         /// Если true, то ThreadPool завершает работу и необходимо завершить выполнение всех потоков.
         std::atomic<bool> IsTerminating;
-        /// В пустую очередь задач добавили задачу. Используется, чтобы избежать ложных пробуждений.
-        bool NotifyThreadFlag = false;
-        /// Все задачи были выполнены. Используется, чтобы избежать ложных пробуждений.
-        bool NotifyAllTasksDoneFlag = false;
-        /// Ожидаемая задача была выполнена. Используется, чтобы избежать ложных пробуждений.
-        bool NotifyOneTaskDoneFlag = false;
-        /// Если true, то ThreadPool ожидает окончания выполнения всех задач.
-        bool IsWaitingAllDone = false;
-        /// Уведомить ThreadHandler, что очередь задач пополнилась.
-        std::condition_variable NotifyThread;
-        /// Уведомить ThreadPool, что все задачи были выполнены.
-        std::condition_variable NotifyAllDone;
-        /// Уведомить ThreadPool, что задание, которое он ожидал выполнено.
-        std::condition_variable NotifyOneTaskDone;
-        /// Контроль над доступом к общим для всех потоков данным.
-        std::mutex ThreadPoolBaseAccess;
-
-        /// Количество добавленных в ThreadPool заданий.
-        size_t TasksCount = 0;
-        /// Количество выполненных заданий.
-        size_t DoneTasksCount = 0;
-
-        /// Выполненные или находящиеся в процессе выполнения задания.
-        std::unordered_map<TaskId, TaskBase*> TasksInProgress;
-        /// Очередь заданий для выполнения.
-        std::deque<TaskBase*> TasksQueue;
+
+        /// Количество добавленных, но ещё не выполненных заданий. WaitAll() ожидает его обнуления.
+        alignas(CacheLineSize) std::atomic<size_t> OutstandingTasksCount = 0;
+
+        /// Количество спящих потоков. Позволяет не захватывать мьютекс, если все потоки заняты.
+        alignas(CacheLineSize) std::atomic<size_t> IdleHandlersCount = 0;
+        /// Контроль над доступом к списку спящих потоков.
+        std::mutex IdleHandlersAccess;
+        /// Спящие потоки.
+        std::vector<ThreadHandler*> IdleHandlers;
+
+        /// Количество заданий во всех почтовых ящиках.
+        alignas(CacheLineSize) std::atomic<size_t> MailboxTasksCount = 0;
+        /// Время, после которого задание из почтового ящика может забрать другой поток, нс.
+        /// Отрицательное значение запрещает кражу.
+        std::atomic<int64_t> AffinityStealDelay = -1;
+        /// Почтовые ящики потоков, индекс совпадает с ThreadHandler::GetIndex().
+        /// Хранятся отдельно от ThreadHandler, чтобы задания можно было освободить после
+        /// завершения потоков.
+        std::deque<WorkerMailbox> Mailboxes;
+
+        /// Асинхронный ввод-вывод или nullptr. Устанавливается один раз в EnableAsyncIo().
+        std::atomic<AsyncFileIo*>    AsyncIo = nullptr;
+        std::unique_ptr<AsyncFileIo> AsyncIoOwner;
+        /// Спящий поток, который ожидает завершения операций ввода-вывода вместо сигнала.
+        /// Такой поток один, остальные спят как обычно.
+        std::atomic<ThreadHandler*>  CompletionsWaiter = nullptr;
+
+        /// Выполнение в волокнах или nullptr. Устанавливается один раз в EnableFibers().
+        std::atomic<FiberRuntime*>    Fibers = nullptr;
+        std::unique_ptr<FiberRuntime> FibersOwner;
+
+        /// Общий набор потоков или nullptr, если ThreadPool создаёт собственные потоки.
+        WorkerArena* Arena = nullptr;
+        /// Количество обработчиков в очереди WorkerArena или выполняемых её потоками.
+        /// Защищено WorkerArena::ArenaAccess.
+        size_t       ArenaActiveHandlersCount = 0;
+
+        /// std::deque не перемещает элементы при добавлении, что позволяет хранить в
+        /// ThreadHandler атомарные поля и работающий поток.
+        std::deque<ThreadHandler> Handlers;
     };
 
-    class ThreadPool : public ThreadPoolBase
+    ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+    ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+    /**
+     * @brief ThreadPool, настраиваемый стратегиями на этапе компиляции.
+     *
+     * Возможности, не нужные выбранной конфигурации (таблица результатов, ожидание
+     * отдельных заданий, почтовые ящики, ввод-вывод, волокна, WorkerArena), не компилируются
+     * и не замедляют добавление и выполнение заданий.
+     *
+     * @tparam QueuePolicy    Очередь заданий: MutexQueuePolicy, LockFreeQueuePolicy.
+     * @tparam WaitPolicy     Ожидание отдельных заданий: TaskWaitPolicy, NoTaskWaitPolicy.
+     * @tparam ResultPolicy   Хранение результатов: TrackResultPolicy, DiscardResultPolicy.
+     * @tparam AllocPolicy    Выделение памяти под задания: HeapAllocPolicy, PoolAllocPolicy.
+     * @tparam FeaturesPolicy Дополнительные возможности: AllFeaturesPolicy, NoFeaturesPolicy
+     *                        или другой FeatureSetPolicy.
+    */
+    template <typename QueuePolicy    = MutexQueuePolicy,
+              typename WaitPolicy     = TaskWaitPolicy,
+              typename ResultPolicy   = TrackResultPolicy,
+              typename AllocPolicy    = HeapAllocPolicy,
+              typename FeaturesPolicy = AllFeaturesPolicy>
+    class BasicThreadPool : public ThreadPoolBase
     {
+        static_assert(!WaitPolicy::IsEnabled || ResultPolicy::IsEnabled,
+                      "Waiting for a task requires ThreadPool to track task results");
+
     public:
-        ThreadPool(const size_t threadsCount);
+        BasicThreadPool(const size_t threadsCount);
 
-        ~ThreadPool();
+        /**
+         * @brief Создать ThreadPool на общем наборе потоков.
+         *
+         * @param concurrencyShare Максимальное количество потоков arena, одновременно
+         * выполняющих задания этого ThreadPool.
+        */
+        BasicThreadPool(WorkerArena& arena, const size_t concurrencyShare);
 
+        ~BasicThreadPool();
+
+        /**
+         * @brief Добавить задание на выполнение.
+         *
+         * Доступно только при ResultPolicy, хранящей результаты. Для остальных ThreadPool
+         * используется Post().
+         *
+         * @param isWaitable Если true, то результат задания будет храниться до вызова
+         * GetTaskResult().
+         *
+         * @return Идентификатор задания.
+        */
         template <typename Funct, typename... Args>
         TaskId AddTask(const bool isWaitable, Funct funct, Args... args);
 
+        /**
+         * @brief Добавить задание, результат которого не нужен.
+         *
+         * Доступно при любой ResultPolicy. Задание нельзя ожидать через Wait(), его завершение
+         * учитывается только в WaitAll().
+        */
+        template <typename Funct, typename... Args>
+        void Post(Funct funct, Args... args);
+
+        /**
+         * @brief Добавить задание на выполнение определённым потоком.
+         *
+         * Задания одного потока выполняются им в порядке добавления и раньше заданий из общей
+         * очереди, поэтому данные, с которыми они работают, остаются в кэше ядра. Если включена
+         * кража (EnableAffinityStealing), то задание может выполнить другой поток.
+         *
+         * @param handlerIndex Номер потока, от 0 до GetThreadsCount().
+        */
+        template <typename Funct, typename... Args>
+        TaskId AddTaskOn(const size_t handlerIndex, const bool isWaitable, Funct funct, Args... args);
+
+        /**
+         * @brief Добавить задание на выполнение потоком, выбранным по хешу ключа.
+         *
+         * Задания с одинаковым ключом попадают в один поток.
+        */
+        template <typename Key, typename Funct, typename... Args>
+        TaskId AddTaskForKey(const Key& key, const bool isWaitable, Funct funct, Args... args);
+
+        /**
+         * @brief Получить результат выполнения задания и освободить его ресурсы.
+         *
+         * Может вызываться одновременно с Wait() для того же задания: задание освобождается
+         * после выхода из Wait() последнего ожидающего.
+        */
         template <typename RetType>
         RetType GetTaskResult(TaskId id);
 
-        template <>
-        void GetTaskResult<void>(TaskId id);
-
+        /**
+         * @brief Ожидать завершения выполнения определённого задания.
+        */
         void Wait(TaskId id);
 
-        void WaitAll();
+        /**
+         * @brief Включить асинхронный файловый ввод-вывод, выполняемый потоками ThreadPool.
+         *
+         * Вызывается один раз. Объект AsyncFileIo существует до уничтожения ThreadPool.
+        */
+        AsyncFileIo& EnableAsyncIo(const AsyncIoSettings& settings = AsyncIoSettings());
+
+        /**
+         * @brief Выполнять задания в волокнах. Задание, ожидающее другое задание в Wait(),
+         * приостанавливает своё волокно и не занимает поток.
+         *
+         * Вызывается один раз, обычно до добавления заданий. Задания, начатые раньше,
+         * выполняются на стеках потоков. Объект FiberRuntime существует до уничтожения ThreadPool.
+         * Если система не поддерживает волокна (не POSIX), то завершает программу.
+        */
+        FiberRuntime& EnableFibers(const FiberSettings& settings = FiberSettings());
+
+    protected:
+        void OnRunningThread(ThreadHandler& handler) override;
+
+        void FinishFiberTask(ThreadHandler& handler, TaskBase* const task) override;
+
+        /**
+         * @brief Создать задание и учесть его добавление.
+         *
+         * @param taskId Идентификатор созданного задания.
+        */
+        template <typename Funct, typename... Args>
+        TaskBase* CreateTask(TaskId& taskId, const bool isWaitable, Funct funct, Args... args);
+
+        /**
+         * @brief Выполнить задание и учесть его завершение. Исключение задания не выходит
+         * за пределы RunTask().
+        */
+        void RunTask(ThreadHandler& handler, TaskBase* const task);
+
+        /**
+         * @brief Учесть завершение выполненного задания: сообщить ожидающим или удалить его.
+        */
+        void FinishTask(ThreadHandler& handler, TaskBase* const task);
+
+        /**
+         * @brief Освободить ссылку на ожидаемое задание и удалить его, если ссылка последняя.
+        */
+        static void ReleaseTask(TrackedTaskBase* const task);
+
+        /**
+         * @brief Проверить, хранится ли задание в таблице результатов до вызова GetTaskResult().
+        */
+        static bool IsWaitableTask(TaskBase* const task);
 
     private:
-        std::vector<ThreadHandler> Handlers;
+        QueuePolicy Queue;
+        [[no_unique_address]] WaitPolicy   Waits;
+        [[no_unique_address]] ResultPolicy Results;
     };
+
+    /// ThreadPool по умолчанию: очередь с мьютексом, хранение результатов и ожидание заданий.
+    typedef BasicThreadPool<MutexQueuePolicy, TaskWaitPolicy,
+                            TrackResultPolicy, HeapAllocPolicy,
+                            AllFeaturesPolicy>                           ThreadPool;
+
+    /// ThreadPool для заданий, результат которых не нужен: lock-free очередь, без таблицы
+    /// результатов, без ожидания отдельных заданий и без дополнительных возможностей.
+    /// Доступно только WaitAll().
+    typedef BasicThreadPool<LockFreeQueuePolicy<>, NoTaskWaitPolicy,
+                            DiscardResultPolicy, PoolAllocPolicy,
+                            NoFeaturesPolicy>                            FireAndForgetThreadPool;
 };
 
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
 
 #include "ThreadPool_impl.h"
+#include "ThreadPoolPolicies_impl.h"
+#include "AsyncFileIo_impl.h"
 
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
-///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
\ No newline at end of file
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
@@ -0,0 +1,343 @@
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+// Модуль ThreadPool, стратегии настройки BasicThreadPool.
+//
+// Версия: 1.3.0.0
+// Дата последнего изменения: 19.10.2026
+//
+// Автор: Маслов А.С. (https://github.com/ArtemMaslov).
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+#include <iostream>
+
+#include "ThreadPool.h"
+
+using namespace ThreadPoolModule;
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+void MutexQueuePolicy::Push(TaskBase* const task)
+{
+    std::unique_lock<std::mutex> lock(QueueAccess);
+    TasksQueue.push_back(task);
+}
+
+TaskBase* MutexQueuePolicy::TryPop()
+{
+    std::unique_lock<std::mutex> lock(QueueAccess);
+
+    if (TasksQueue.empty())
+        return nullptr;
+
+    TaskBase* const task = TasksQueue.front();
+    TasksQueue.pop_front();
+    return task;
+}
+
+bool MutexQueuePolicy::IsEmpty()
+{
+    std::unique_lock<std::mutex> lock(QueueAccess);
+    return TasksQueue.empty();
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+void TaskWaitPolicy::Wait(TrackedTaskBase& task)
+{
+    // Задание было завершено, ожидание не нужно.
+    if (task.IsDone.load(std::memory_order_acquire))
+        return;
+
+    // Задание выполняется в волокне: вместо потока приостанавливаем волокно.
+    Fiber* const fiber = FiberRuntime::GetCurrentFiber();
+    if (fiber != nullptr)
+    {
+        WaitOnFiber(task, fiber);
+        return;
+    }
+
+    // Сообщаем потокам-исполнителям, что после выполнения заданий нужно будить ожидающих.
+    // Порядок seq_cst вместе с записью IsDone в потоке-исполнителе гарантирует, что либо
+    // мы увидим IsDone, либо поток-исполнитель увидит ожидающего.
+    TaskWaitersCount.fetch_add(1);
+
+    while (!task.IsDone.load())
+    {
+        const uint32_t epoch = TaskDoneEpoch.load();
+        // Задание могло быть выполнено до чтения счётчика.
+        if (task.IsDone.load())
+            break;
+        // Было выполнено не наше задание (его ожидал другой поток), ждём дальше.
+        TaskDoneEpoch.wait(epoch);
+    }
+
+    TaskWaitersCount.fetch_sub(1);
+}
+
+void TaskWaitPolicy::OnTaskDone(const TaskId id)
+{
+    if (FiberWaitersCount.load() != 0)
+        ResumeFiberWaiters(id);
+
+    if (TaskWaitersCount.load() != 0)
+    {
+        // Результат задания ожидает ThreadPool, уведомляем его, что задание готово.
+        TaskDoneEpoch.fetch_add(1);
+        TaskDoneEpoch.notify_all();
+    }
+}
+
+void TaskWaitPolicy::WaitOnFiber(TrackedTaskBase& task, Fiber* const fiber)
+{
+    {
+        std::unique_lock<std::mutex> lock(FiberWaitersAccess);
+        FiberWaiters.emplace(task.Id, fiber);
+
+        // Порядок seq_cst вместе с записью IsDone в потоке-исполнителе гарантирует, что либо
+        // мы увидим IsDone, либо поток-исполнитель увидит волокно в таблице.
+        FiberWaitersCount.fetch_add(1);
+
+        if (task.IsDone.load())
+        {
+            auto range = FiberWaiters.equal_range(task.Id);
+            for (auto elemIter = range.first; elemIter != range.second; ++elemIter)
+            {
+                if (elemIter->second == fiber)
+                {
+                    FiberWaiters.erase(elemIter);
+                    break;
+                }
+            }
+            FiberWaitersCount.fetch_sub(1);
+            return;
+        }
+    }
+
+    // Поток-исполнитель может продолжить волокно ещё до приостановки, тогда оно продолжится сразу.
+    FiberRuntime::SuspendCurrentFiber();
+}
+
+void TaskWaitPolicy::ResumeFiberWaiters(const TaskId id)
+{
+    std::vector<Fiber*> fibers;
+    {
+        std::unique_lock<std::mutex> lock(FiberWaitersAccess);
+
+        auto range = FiberWaiters.equal_range(id);
+        for (auto elemIter = range.first; elemIter != range.second; ++elemIter)
+            fibers.push_back(elemIter->second);
+
+        if (fibers.empty())
+            return;
+
+        FiberWaiters.erase(range.first, range.second);
+        FiberWaitersCount.fetch_sub(fibers.size());
+    }
+
+    for (Fiber* const fiber: fibers)
+        FiberRuntime::Resume(fiber);
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+void TrackResultPolicy::Register(TrackedTaskBase* const task)
+{
+    std::unique_lock<std::mutex> lock(ResultsAccess);
+    TasksInProgress.emplace(task->Id, task);
+}
+
+TrackedTaskBase* TrackResultPolicy::Acquire(const TaskId id)
+{
+    std::unique_lock<std::mutex> lock(ResultsAccess);
+
+    auto elemIter = TasksInProgress.find(id);
+    if (elemIter == TasksInProgress.end())
+        return nullptr;
+
+    // Ссылка захватывается под мьютексом, поэтому Extract() не может удалить задание из
+    // таблицы между поиском и захватом.
+    TrackedTaskBase* const task = elemIter->second;
+    task->RefsCount.fetch_add(1, std::memory_order_relaxed);
+    return task;
+}
+
+bool TrackResultPolicy::Release(TrackedTaskBase* const task)
+{
+    return task->RefsCount.fetch_sub(1, std::memory_order_acq_rel) == 1;
+}
+
+TrackedTaskBase* TrackResultPolicy::Extract(const TaskId id)
+{
+    std::unique_lock<std::mutex> lock(ResultsAccess);
+
+    auto elemIter = TasksInProgress.find(id);
+    // Задание не найдено. Задания, которые не планировались к ожиданию, в таблицу не попадают.
+    THREAD_POOL_ASSERT("Attempt to get result of not existing or not waitable task",
+                       elemIter != TasksInProgress.end());
+
+    TrackedTaskBase* const task = elemIter->second;
+
+    // Задание ещё не выполнено.
+    THREAD_POOL_ASSERT("Task have not done yet",
+                       task->IsDone.load(std::memory_order_acquire));
+
+    TasksInProgress.erase(elemIter);
+    return task;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+void HeapAllocPolicy::Delete(TaskBase* const task)
+{
+    delete task;
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+/// Размер заголовка блока. В заголовке хранится номер класса размеров блока.
+static const size_t  PoolBlockHeaderSize   = 16;
+/// Полные размеры блоков (вместе с заголовком) для каждого класса.
+static const size_t  PoolBlockSizes[]      = { 64, 128, 256, 512 };
+static const size_t  PoolClassesCount      = sizeof(PoolBlockSizes) / sizeof(PoolBlockSizes[0]);
+/// Номер класса для блоков, выделенных оператором new.
+static const uint8_t PoolLargeBlockClass   = 0xFF;
+/// Максимальное количество свободных блоков одного класса в кэше потока.
+static const size_t  PoolLocalCacheLimit   = 256;
+/// Количество блоков, передаваемых между кэшем потока и общим списком за один раз.
+static const size_t  PoolTransferBatchSize = 64;
+
+struct PoolFreeBlock
+{
+    PoolFreeBlock* Next;
+};
+
+struct PoolFreeList
+{
+    PoolFreeBlock* Head  = nullptr;
+    size_t         Count = 0;
+
+    void Push(PoolFreeBlock* const block)
+    {
+        block->Next = Head;
+        Head = block;
+        Count++;
+    }
+
+    PoolFreeBlock* Pop()
+    {
+        PoolFreeBlock* const block = Head;
+        Head = block->Next;
+        Count--;
+        return block;
+    }
+};
+
+/// Общие для всех потоков списки свободных блоков.
+struct PoolGlobalFreeList
+{
+    std::mutex   Access;
+    PoolFreeList Blocks;
+};
+
+static PoolGlobalFreeList PoolGlobalFreeLists[PoolClassesCount];
+
+/// Кэш свободных блоков потока. При завершении потока блоки возвращаются в общие списки.
+struct PoolLocalCache
+{
+    PoolFreeList Blocks[PoolClassesCount];
+
+    ~PoolLocalCache()
+    {
+        for (size_t cls = 0; cls < PoolClassesCount; cls++)
+        {
+            std::unique_lock<std::mutex> lock(PoolGlobalFreeLists[cls].Access);
+            while (Blocks[cls].Count != 0)
+                PoolGlobalFreeLists[cls].Blocks.Push(Blocks[cls].Pop());
+        }
+    }
+};
+
+static thread_local PoolLocalCache PoolCache;
+
+static uint8_t GetPoolBlockClass(const size_t size)
+{
+    for (size_t cls = 0; cls < PoolClassesCount; cls++)
+    {
+        if (size + PoolBlockHeaderSize <= PoolBlockSizes[cls])
+            return static_cast<uint8_t>(cls);
+    }
+    return PoolLargeBlockClass;
+}
+
+void* PoolAllocPolicy::Allocate(const size_t size)
+{
+    static_assert(PoolBlockHeaderSize >= BlockAlignment && PoolBlockHeaderSize % BlockAlignment == 0,
+                  "Block header must keep objects aligned");
+
+    const uint8_t cls   = GetPoolBlockClass(size);
+    uint8_t*      block = nullptr;
+
+    if (cls == PoolLargeBlockClass)
+    {
+        block = static_cast<uint8_t*>(::operator new(size + PoolBlockHeaderSize));
+    }
+    else
+    {
+        PoolFreeList& localBlocks = PoolCache.Blocks[cls];
+
+        if (localBlocks.Count == 0)
+        {
+            // Кэш потока пуст, забираем пачку блоков из общего списка.
+            std::unique_lock<std::mutex> lock(PoolGlobalFreeLists[cls].Access);
+            PoolFreeList& globalBlocks = PoolGlobalFreeLists[cls].Blocks;
+            for (size_t st = 0; st < PoolTransferBatchSize && globalBlocks.Count != 0; st++)
+                localBlocks.Push(globalBlocks.Pop());
+        }
+
+        if (localBlocks.Count != 0)
+            block = reinterpret_cast<uint8_t*>(localBlocks.Pop());
+        else
+            block = static_cast<uint8_t*>(::operator new(PoolBlockSizes[cls]));
+    }
+
+    block[0] = cls;
+    return block + PoolBlockHeaderSize;
+}
+
+void PoolAllocPolicy::Deallocate(void* const ptr)
+{
+    uint8_t* const block = static_cast<uint8_t*>(ptr) - PoolBlockHeaderSize;
+    const uint8_t  cls   = block[0];
+
+    if (cls == PoolLargeBlockClass)
+    {
+        ::operator delete(block);
+        return;
+    }
+
+    PoolFreeList& localBlocks = PoolCache.Blocks[cls];
+    localBlocks.Push(reinterpret_cast<PoolFreeBlock*>(block));
+
+    if (localBlocks.Count > PoolLocalCacheLimit)
+    {
+        // Задания обычно создаёт один поток, а удаляют другие. Излишек возвращаем в общий
+        // список, чтобы создающий поток мог его переиспользовать.
+        std::unique_lock<std::mutex> lock(PoolGlobalFreeLists[cls].Access);
+        PoolFreeList& globalBlocks = PoolGlobalFreeLists[cls].Blocks;
+        for (size_t st = 0; st < PoolTransferBatchSize; st++)
+            globalBlocks.Push(localBlocks.Pop());
+    }
+}
+
+void PoolAllocPolicy::Delete(TaskBase* const task)
+{
+    task->~TaskBase();
+    Deallocate(task);
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
@@ -0,0 +1,350 @@
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+// Модуль ThreadPool, стратегии настройки BasicThreadPool.
+//
+// Версия: 1.3.0.0
+// Дата последнего изменения: 19.10.2026
+//
+// Автор: Маслов А.С. (https://github.com/ArtemMaslov).
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include <deque>
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+namespace ThreadPoolModule
+{
+    typedef size_t TaskId;
+
+    /// Размер кэш-линии. Часто изменяемые разными потоками счётчики выравниваются по нему,
+    /// чтобы избежать ложного разделения (false sharing).
+    constexpr size_t CacheLineSize = 64;
+
+    class TaskBase;
+    class TrackedTaskBase;
+    class Fiber;
+
+    ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+    //                                 Очередь заданий
+    ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+    /**
+     * @brief Очередь заданий на основе std::deque, защищённая мьютексом.
+    */
+    class MutexQueuePolicy
+    {
+    public:
+        /**
+         * @brief Добавить задание в конец очереди.
+        */
+        void Push(TaskBase* const task);
+
+        /**
+         * @brief Извлечь задание из начала очереди.
+         *
+         * @return Задание или nullptr, если очередь пуста.
+        */
+        TaskBase* TryPop();
+
+        /**
+         * @brief Проверить, пуста ли очередь.
+        */
+        bool IsEmpty();
+
+    private:
+        /// Контроль над доступом к очереди.
+        std::mutex QueueAccess;
+        /// Очередь заданий для выполнения.
+        std::deque<TaskBase*> TasksQueue;
+    };
+
+    /**
+     * @brief Ограниченная lock-free очередь заданий для нескольких производителей и потребителей.
+     *
+     * Кольцевой буфер, в котором каждая ячейка хранит номер последовательности (очередь
+     * Д. Вьюкова). Lock-free только первые Capacity заданий: если буфер заполнен, задания
+     * добавляются в дополнительную очередь под мьютексом, пока она не опустеет. Поэтому Push()
+     * не ждёт потоки-исполнители и может вызываться из задания, даже если все потоки заняты
+     * добавлением заданий.
+     *
+     * @tparam Capacity Размер кольцевого буфера, степень двойки.
+    */
+    template <size_t Capacity = 16384>
+    class LockFreeQueuePolicy
+    {
+        static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                      "Queue capacity must be a power of two");
+
+    public:
+        LockFreeQueuePolicy();
+
+        /**
+         * @brief Добавить задание в конец очереди.
+        */
+        void Push(TaskBase* const task);
+
+        /**
+         * @brief Извлечь задание из начала очереди.
+         *
+         * @return Задание или nullptr, если очередь пуста.
+        */
+        TaskBase* TryPop();
+
+        /**
+         * @brief Проверить, пуста ли очередь.
+        */
+        bool IsEmpty() const;
+
+    private:
+        /**
+         * @brief Добавить задание в кольцевой буфер.
+         *
+         * @return false, если буфер заполнен.
+        */
+        bool TryPushToRing(TaskBase* const task);
+
+        /**
+         * @brief Извлечь задание из дополнительной очереди.
+        */
+        TaskBase* TryPopOverflow();
+
+        struct Cell
+        {
+            /// Номер позиции, для которой ячейка готова к записи (Sequence == pos)
+            /// или к чтению (Sequence == pos + 1).
+            std::atomic<size_t> Sequence;
+            TaskBase*           Task;
+        };
+
+        static constexpr size_t CellsMask = Capacity - 1;
+
+        std::unique_ptr<Cell[]> Cells;
+        /// Позиция записи. Производители и потребители изменяют разные кэш-линии.
+        alignas(CacheLineSize) std::atomic<size_t> EnqueuePos = 0;
+        /// Позиция чтения.
+        alignas(CacheLineSize) std::atomic<size_t> DequeuePos = 0;
+
+        /// Количество заданий в дополнительной очереди. Пока оно не 0, новые задания добавляются
+        /// туда же, чтобы не обгонять более ранние.
+        alignas(CacheLineSize) std::atomic<size_t> OverflowCount = 0;
+        /// Контроль над доступом к дополнительной очереди.
+        std::mutex OverflowAccess;
+        /// Задания, не поместившиеся в кольцевой буфер.
+        std::deque<TaskBase*> Overflow;
+    };
+
+    ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+    //                           Ожидание отдельных заданий
+    ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+    /**
+     * @brief Поддержка ThreadPool::Wait(id).
+     *
+     * Если Wait() вызван из задания, выполняемого в волокне (ThreadPoolBase::EnableFibers()),
+     * то приостанавливается волокно, а не поток.
+    */
+    class TaskWaitPolicy
+    {
+    public:
+        static constexpr bool IsEnabled = true;
+
+        /**
+         * @brief Ожидать выполнения задания.
+        */
+        void Wait(TrackedTaskBase& task);
+
+        /**
+         * @brief Вызывается потоком-исполнителем после того, как задание отмечено выполненным.
+         *
+         * Будит ожидающих, только если они есть.
+         *
+         * @param id Идентификатор выполненного задания. Само задание уже может быть удалено.
+        */
+        void OnTaskDone(const TaskId id);
+
+    private:
+        /**
+         * @brief Приостановить волокно до выполнения задания.
+        */
+        void WaitOnFiber(TrackedTaskBase& task, Fiber* const fiber);
+
+        /**
+         * @brief Продолжить волокна, ожидающие задание.
+        */
+        void ResumeFiberWaiters(const TaskId id);
+
+        /// Количество потоков, ожидающих в Wait() выполнения конкретного задания.
+        alignas(CacheLineSize) std::atomic<size_t> TaskWaitersCount = 0;
+        /// Количество волокон, приостановленных в Wait().
+        std::atomic<size_t> FiberWaitersCount = 0;
+        /// Счётчик выполненных заданий, на которых ожидают в Wait(). Используется как адрес
+        /// для std::atomic::wait() / notify_all().
+        std::atomic<uint32_t> TaskDoneEpoch = 0;
+
+        /// Контроль над доступом к таблице приостановленных волокон.
+        std::mutex FiberWaitersAccess;
+        /// Волокна, приостановленные в Wait(), по идентификатору ожидаемого задания.
+        std::unordered_multimap<TaskId, Fiber*> FiberWaiters;
+    };
+
+    /**
+     * @brief ThreadPool::Wait(id) недоступен, потоки-исполнители никого не будят.
+    */
+    class NoTaskWaitPolicy
+    {
+    public:
+        static constexpr bool IsEnabled = false;
+    };
+
+    ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+    //                            Хранение результатов заданий
+    ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+    /**
+     * @brief Результаты ожидаемых заданий хранятся в таблице до вызова GetTaskResult().
+    */
+    class TrackResultPolicy
+    {
+    public:
+        static constexpr bool IsEnabled = true;
+
+        /// Базовый класс заданий ThreadPool.
+        typedef TrackedTaskBase TaskBaseType;
+
+        /**
+         * @brief Занести задание в таблицу. Вызывается до добавления задания в очередь.
+        */
+        void Register(TrackedTaskBase* const task);
+
+        /**
+         * @brief Найти задание в таблице и захватить ссылку на него. Задание не будет
+         * освобождено до вызова Release(), даже если его результат уже получен.
+         *
+         * @return Задание или nullptr, если его нет в таблице.
+        */
+        TrackedTaskBase* Acquire(const TaskId id);
+
+        /**
+         * @brief Освободить ссылку на задание, захваченную Acquire() или таблицей.
+         *
+         * @return true, если ссылка была последней и задание нужно освободить.
+        */
+        static bool Release(TrackedTaskBase* const task);
+
+        /**
+         * @brief Удалить выполненное задание из таблицы.
+         *
+         * @return Задание. Освобождать его ресурсы должен вызывающий.
+        */
+        TrackedTaskBase* Extract(const TaskId id);
+
+        /**
+         * @brief Удалить из таблицы все задания.
+         *
+         * @param deleteTask Функция освобождения ресурсов задания.
+        */
+        template <typename DeleteFunct>
+        void Clear(DeleteFunct deleteTask);
+
+    private:
+        /// Контроль над доступом к таблице.
+        std::mutex ResultsAccess;
+        /// Задания, результат которых будет получать пользователь (IsWaitable = true).
+        /// Задания попадают в таблицу при добавлении и удаляются в GetTaskResult().
+        std::unordered_map<TaskId, TrackedTaskBase*> TasksInProgress;
+    };
+
+    /**
+     * @brief Результаты не хранятся, задания удаляются сразу после выполнения.
+    */
+    class DiscardResultPolicy
+    {
+    public:
+        static constexpr bool IsEnabled = false;
+
+        /// Базовый класс заданий ThreadPool. Не содержит полей для ожидания и результата.
+        typedef TaskBase TaskBaseType;
+    };
+
+    ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+    //                          Дополнительные возможности
+    ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+    /**
+     * @brief Набор дополнительных возможностей ThreadPool.
+     *
+     * Проверки выключенных возможностей не компилируются в цикл потока-исполнителя, а методы,
+     * которые их включают, недоступны.
+     *
+     * @tparam HasAffinity Почтовые ящики потоков: AddTaskOn(), AddTaskForKey(), кража заданий.
+     * @tparam HasAsyncIo  Асинхронный ввод-вывод: EnableAsyncIo().
+     * @tparam HasFibers   Выполнение заданий в волокнах: EnableFibers().
+     * @tparam HasArena    Выполнение на общем наборе потоков WorkerArena.
+    */
+    template <bool HasAffinity, bool HasAsyncIo, bool HasFibers, bool HasArena>
+    class FeatureSetPolicy
+    {
+    public:
+        static constexpr bool IsAffinityEnabled = HasAffinity;
+        static constexpr bool IsAsyncIoEnabled  = HasAsyncIo;
+        static constexpr bool IsFibersEnabled   = HasFibers;
+        static constexpr bool IsArenaEnabled    = HasArena;
+    };
+
+    /// Все возможности.
+    typedef FeatureSetPolicy<true, true, true, true>     AllFeaturesPolicy;
+    /// Только общая очередь заданий.
+    typedef FeatureSetPolicy<false, false, false, false> NoFeaturesPolicy;
+
+    ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+    //                          Выделение памяти под задания
+    ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+    /**
+     * @brief Задания создаются операторами new и delete.
+    */
+    class HeapAllocPolicy
+    {
+    public:
+        template <typename TaskType, typename... Args>
+        static TaskType* New(Args&&... args);
+
+        static void Delete(TaskBase* const task);
+    };
+
+    /**
+     * @brief Задания создаются в блоках фиксированных размеров, которые переиспользуются.
+     *
+     * Каждый поток держит небольшой кэш свободных блоков и обменивается с общим списком
+     * пачками, поэтому мьютекс захватывается редко. Задания, не помещающиеся в наибольший
+     * блок, создаются оператором new.
+    */
+    class PoolAllocPolicy
+    {
+    public:
+        template <typename TaskType, typename... Args>
+        static TaskType* New(Args&&... args);
+
+        static void Delete(TaskBase* const task);
+
+    private:
+        /// Выравнивание объектов в блоках.
+        static constexpr size_t BlockAlignment = 16;
+
+        static void* Allocate(const size_t size);
+
+        static void  Deallocate(void* const ptr);
+    };
+};
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
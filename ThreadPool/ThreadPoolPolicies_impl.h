@@ -0,0 +1,181 @@
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+// Модуль ThreadPool, шаблонные методы стратегий.
+//
+// Версия: 1.2.0.0
+// Дата последнего изменения: 19.10.2026
+//
+// Автор: Маслов А.С. (https://github.com/ArtemMaslov).
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+#include <new>
+#include <utility>
+
+#include "ThreadPool.h"
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+namespace ThreadPoolModule
+{
+    template <size_t Capacity>
+    LockFreeQueuePolicy<Capacity>::LockFreeQueuePolicy() :
+        Cells(new Cell[Capacity])
+    {
+        for (size_t st = 0; st < Capacity; st++)
+            Cells[st].Sequence.store(st, std::memory_order_relaxed);
+    }
+
+    template <size_t Capacity>
+    void LockFreeQueuePolicy<Capacity>::Push(TaskBase* const task)
+    {
+        if (OverflowCount.load(std::memory_order_acquire) == 0 && TryPushToRing(task))
+            return;
+
+        std::lock_guard<std::mutex> lock(OverflowAccess);
+        Overflow.push_back(task);
+        OverflowCount.fetch_add(1, std::memory_order_release);
+    }
+
+    template <size_t Capacity>
+    bool LockFreeQueuePolicy<Capacity>::TryPushToRing(TaskBase* const task)
+    {
+        size_t pos = EnqueuePos.load(std::memory_order_relaxed);
+        Cell*  cell = nullptr;
+
+        while (true)
+        {
+            cell = &Cells[pos & CellsMask];
+            const size_t    sequence = cell->Sequence.load(std::memory_order_acquire);
+            const ptrdiff_t diff     = static_cast<ptrdiff_t>(sequence) - static_cast<ptrdiff_t>(pos);
+
+            if (diff == 0)
+            {
+                // Ячейка свободна, пытаемся её занять.
+                if (EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0)
+            {
+                // Буфер заполнен.
+                return false;
+            }
+            else
+            {
+                // Ячейку занял другой производитель.
+                pos = EnqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->Task = task;
+        cell->Sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <size_t Capacity>
+    TaskBase* LockFreeQueuePolicy<Capacity>::TryPop()
+    {
+        size_t pos = DequeuePos.load(std::memory_order_relaxed);
+        Cell*  cell = nullptr;
+
+        while (true)
+        {
+            cell = &Cells[pos & CellsMask];
+            const size_t    sequence = cell->Sequence.load(std::memory_order_acquire);
+            const ptrdiff_t diff     = static_cast<ptrdiff_t>(sequence) - static_cast<ptrdiff_t>(pos + 1);
+
+            if (diff == 0)
+            {
+                // В ячейке есть задание, пытаемся его забрать.
+                if (DequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0)
+            {
+                // Буфер пуст, остались только задания, не поместившиеся в него.
+                return TryPopOverflow();
+            }
+            else
+            {
+                // Задание забрал другой поток-исполнитель.
+                pos = DequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        TaskBase* const task = cell->Task;
+        // Ячейка будет свободна для записи на следующем обороте буфера.
+        cell->Sequence.store(pos + CellsMask + 1, std::memory_order_release);
+        return task;
+    }
+
+    template <size_t Capacity>
+    TaskBase* LockFreeQueuePolicy<Capacity>::TryPopOverflow()
+    {
+        if (OverflowCount.load(std::memory_order_acquire) == 0)
+            return nullptr;
+
+        std::lock_guard<std::mutex> lock(OverflowAccess);
+        if (Overflow.empty())
+            return nullptr;
+
+        TaskBase* const task = Overflow.front();
+        Overflow.pop_front();
+        OverflowCount.fetch_sub(1, std::memory_order_release);
+        return task;
+    }
+
+    template <size_t Capacity>
+    bool LockFreeQueuePolicy<Capacity>::IsEmpty() const
+    {
+        if (OverflowCount.load(std::memory_order_acquire) != 0)
+            return false;
+
+        const size_t pos      = DequeuePos.load(std::memory_order_relaxed);
+        const size_t sequence = Cells[pos & CellsMask].Sequence.load(std::memory_order_acquire);
+        return static_cast<ptrdiff_t>(sequence) - static_cast<ptrdiff_t>(pos + 1) < 0;
+    }
+
+    ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+    ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+    template <typename DeleteFunct>
+    void TrackResultPolicy::Clear(DeleteFunct deleteTask)
+    {
+        std::unique_lock<std::mutex> lock(ResultsAccess);
+
+        for (std::pair<TaskId, TrackedTaskBase*> elem: TasksInProgress)
+        {
+            deleteTask(elem.second);
+        }
+        TasksInProgress.clear();
+    }
+
+    ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+    ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+    template <typename TaskType, typename... Args>
+    TaskType* HeapAllocPolicy::New(Args&&... args)
+    {
+        return new TaskType(std::forward<Args>(args)...);
+    }
+
+    template <typename TaskType, typename... Args>
+    TaskType* PoolAllocPolicy::New(Args&&... args)
+    {
+        static_assert(alignof(TaskType) <= BlockAlignment,
+                      "Task alignment is greater than pool block alignment");
+
+        void* const memory = Allocate(sizeof(TaskType));
+        try
+        {
+            return new (memory) TaskType(std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            Deallocate(memory);
+            throw;
+        }
+    }
+}
+
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
@@ -1,14 +1,15 @@
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
 // Модуль ThreadPool, шаблонные методы.
-// 
-// Версия: 1.0.0.1
-// Дата последнего изменения: 30.03.2023
-// 
+//
+// Версия: 1.6.0.0
+// Дата последнего изменения: 19.10.2026
+//
 // Автор: Маслов А.С. (https://github.com/ArtemMaslov).
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
 
 #include <cassert>
 #include <functional>
+#include <type_traits>
 
 #include "ThreadPool.h"
 
@@ -19,7 +20,7 @@
     #define THREAD_POOL_PRINTF(...) \
         printf(__VA_ARGS__)
 #else
-    #define THREAD_POOL_PRINTF(...) 
+    #define THREAD_POOL_PRINTF(...)
 #endif
 
 #define THREAD_POOL_ASSERT(msgerr, expr) \
@@ -36,65 +37,494 @@
 
 namespace ThreadPoolModule
 {
+    template <typename QueuePolicy, typename WaitPolicy, typename ResultPolicy, typename AllocPolicy,
+              typename FeaturesPolicy>
+    BasicThreadPool<QueuePolicy, WaitPolicy, ResultPolicy, AllocPolicy, FeaturesPolicy>::BasicThreadPool(
+        const size_t threadsCount) :
+        ThreadPoolBase(),
+        Queue(),
+        Waits(),
+        Results()
+    {
+        // Потоки создаются в конструкторе наследника, чтобы виртуальный OnRunningThread()
+        // вызывался у полностью созданного объекта.
+        try
+        {
+            StartThreads(threadsCount);
+        }
+        catch (...)
+        {
+            // В случае исключения созданные потоки будут корректно освобождены.
+            StopThreads();
+            throw;
+        }
+    }
+
+    template <typename QueuePolicy, typename WaitPolicy, typename ResultPolicy, typename AllocPolicy,
+              typename FeaturesPolicy>
+    BasicThreadPool<QueuePolicy, WaitPolicy, ResultPolicy, AllocPolicy, FeaturesPolicy>::BasicThreadPool(
+        WorkerArena& arena, const size_t concurrencyShare) :
+        ThreadPoolBase(),
+        Queue(),
+        Waits(),
+        Results()
+    {
+        static_assert(FeaturesPolicy::IsArenaEnabled, "ThreadPool does not support WorkerArena");
+
+        try
+        {
+            StartThreads(concurrencyShare, &arena);
+        }
+        catch (...)
+        {
+            StopThreads();
+            throw;
+        }
+    }
+
+    template <typename QueuePolicy, typename WaitPolicy, typename ResultPolicy, typename AllocPolicy,
+              typename FeaturesPolicy>
+    BasicThreadPool<QueuePolicy, WaitPolicy, ResultPolicy, AllocPolicy, FeaturesPolicy>::~BasicThreadPool()
+    {
+        // Потоки завершаются до освобождения заданий, так как могут выполнять одно из них.
+        StopThreads();
+
+        // Волокна, ожидавшие другие задания, уже не будут продолжены. Ожидаемые задания
+        // находятся в таблице и освобождаются вместе с ней.
+        if constexpr (FeaturesPolicy::IsFibersEnabled)
+        {
+            for (TaskBase* const task: ExtractSuspendedFiberTasks())
+            {
+                if (!IsWaitableTask(task))
+                    AllocPolicy::Delete(task);
+            }
+        }
+
+        // Очищаем все задачи, так как пользователь не сможет получить к ним доступ.
+        // Ожидаемые задания из очереди также находятся в таблице.
+        if constexpr (ResultPolicy::IsEnabled)
+            Results.Clear(AllocPolicy::Delete);
+
+        while (TaskBase* const task = Queue.TryPop())
+        {
+            if (!IsWaitableTask(task))
+                AllocPolicy::Delete(task);
+        }
+
+        if constexpr (FeaturesPolicy::IsAffinityEnabled)
+        {
+            for (size_t index = 0; index < Mailboxes.size(); index++)
+            {
+                while (TaskBase* const task = TryPopMailbox(index))
+                {
+                    if (!IsWaitableTask(task))
+                        AllocPolicy::Delete(task);
+                }
+            }
+        }
+    }
+
+    ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+    ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+    template <typename QueuePolicy, typename WaitPolicy, typename ResultPolicy, typename AllocPolicy,
+              typename FeaturesPolicy>
+    template <typename Funct, typename... Args>
+    TaskId BasicThreadPool<QueuePolicy, WaitPolicy, ResultPolicy, AllocPolicy, FeaturesPolicy>::AddTask(
+        const bool isWaitable, Funct funct, Args... args)
+    {
+        static_assert(ResultPolicy::IsEnabled, "ThreadPool does not keep task results, use Post()");
+
+        TaskId taskId = 0;
+        TaskBase* const task = CreateTask(taskId, isWaitable, funct, args...);
+
+        THREAD_POOL_PRINTF("ThreadPool: adding task %zd to queue\n", taskId);
+        // После добавления в очередь не ожидаемое задание может быть сразу выполнено и удалено.
+        Queue.Push(task);
+        WakeOneHandler();
+
+        return taskId;
+    }
+
+    template <typename QueuePolicy, typename WaitPolicy, typename ResultPolicy, typename AllocPolicy,
+              typename FeaturesPolicy>
     template <typename Funct, typename... Args>
-    TaskId ThreadPool::AddTask(const bool isWaitable, Funct funct, Args... args)
+    void BasicThreadPool<QueuePolicy, WaitPolicy, ResultPolicy, AllocPolicy, FeaturesPolicy>::Post(
+        Funct funct, Args... args)
+    {
+        TaskId taskId = 0;
+        TaskBase* const task = CreateTask(taskId, false, funct, args...);
+
+        THREAD_POOL_PRINTF("ThreadPool: posting task %zd to queue\n", taskId);
+        Queue.Push(task);
+        WakeOneHandler();
+    }
+
+    template <typename QueuePolicy, typename WaitPolicy, typename ResultPolicy, typename AllocPolicy,
+              typename FeaturesPolicy>
+    template <typename Funct, typename... Args>
+    TaskId BasicThreadPool<QueuePolicy, WaitPolicy, ResultPolicy, AllocPolicy, FeaturesPolicy>::AddTaskOn(
+        const size_t handlerIndex, const bool isWaitable, Funct funct, Args... args)
+    {
+        static_assert(FeaturesPolicy::IsAffinityEnabled, "ThreadPool does not support thread mailboxes");
+        static_assert(ResultPolicy::IsEnabled, "ThreadPool does not keep task results, use Post()");
+
+        THREAD_POOL_ASSERT("Attempt to add task to not existing thread",
+                           handlerIndex < GetThreadsCount());
+
+        TaskId taskId = 0;
+        TaskBase* const task = CreateTask(taskId, isWaitable, funct, args...);
+
+        THREAD_POOL_PRINTF("ThreadPool: adding task %zd to thread #%zd\n", taskId, handlerIndex);
+        PushToMailbox(handlerIndex, task);
+
+        return taskId;
+    }
+
+    template <typename QueuePolicy, typename WaitPolicy, typename ResultPolicy, typename AllocPolicy,
+              typename FeaturesPolicy>
+    template <typename Key, typename Funct, typename... Args>
+    TaskId BasicThreadPool<QueuePolicy, WaitPolicy, ResultPolicy, AllocPolicy, FeaturesPolicy>::AddTaskForKey(
+        const Key& key, const bool isWaitable, Funct funct, Args... args)
+    {
+        const size_t handlerIndex = std::hash<Key>()(key) % GetThreadsCount();
+        return AddTaskOn(handlerIndex, isWaitable, funct, args...);
+    }
+
+    template <typename QueuePolicy, typename WaitPolicy, typename ResultPolicy, typename AllocPolicy,
+              typename FeaturesPolicy>
+    template <typename Funct, typename... Args>
+    TaskBase* BasicThreadPool<QueuePolicy, WaitPolicy, ResultPolicy, AllocPolicy, FeaturesPolicy>::CreateTask(
+        TaskId& taskId, const bool isWaitable, Funct funct, Args... args)
     {
         typedef decltype(funct(args...)) retType;
+        typedef decltype(std::bind(funct, args...)) callableType;
+
+        typedef typename ResultPolicy::TaskBaseType taskBaseType;
 
-        std::packaged_task<retType()> packagedTask(std::bind(funct, args...));
-        Task<retType>* task = new Task<retType>(std::move(packagedTask));
-        task->IsWaitable = isWaitable;
+        taskId = 0;
+        if constexpr (ResultPolicy::IsEnabled)
+            taskId = TaskBase::GenerateId();
 
+        // Результат не ожидаемого задания никто не получит, поэтому для него не создаются
+        // std::packaged_task и std::future.
+        taskBaseType* task = nullptr;
+        if constexpr (ResultPolicy::IsEnabled)
         {
-            std::unique_lock<std::mutex> lock(ThreadPoolBaseAccess);
-            THREAD_POOL_PRINTF("ThreadPool: adding task %zd to queue\n", task->Id);
-            TasksQueue.push_back(task);
+            if (isWaitable)
+                task = AllocPolicy::template New<Task<retType>>(taskId, std::bind(funct, args...));
+        }
 
-            TasksCount++;
-            NotifyThreadFlag = true;
-            NotifyThread.notify_one();
+        if (task == nullptr)
+        {
+            task = AllocPolicy::template New<CallableTask<callableType, taskBaseType>>(
+                taskId, std::bind(funct, args...));
         }
 
-        return task->Id;
+        OnTaskAdded();
+
+        // Задание заносится в таблицу до начала выполнения, поэтому потоку-исполнителю
+        // не нужно обращаться к таблице после его завершения.
+        if constexpr (ResultPolicy::IsEnabled)
+        {
+            task->IsWaitable = isWaitable;
+            if (isWaitable)
+                Results.Register(task);
+        }
+
+        return task;
     }
 
+    template <typename QueuePolicy, typename WaitPolicy, typename ResultPolicy, typename AllocPolicy,
+              typename FeaturesPolicy>
     template <typename RetType>
-    RetType ThreadPool::GetTaskResult(TaskId id)
+    RetType BasicThreadPool<QueuePolicy, WaitPolicy, ResultPolicy, AllocPolicy, FeaturesPolicy>::GetTaskResult(
+        TaskId id)
     {
+        static_assert(ResultPolicy::IsEnabled, "ThreadPool does not keep task results");
+
         THREAD_POOL_PRINTF("ThreadPool: find task #%zd\n", id);
 
-        auto elemIter = TasksInProgress.find(id);
-        // Задание не найдено.
-        THREAD_POOL_ASSERT("Attempt to get result of not existing task",
-                           elemIter != TasksInProgress.end());
-        
-        Task<RetType>* task = static_cast<Task<RetType>*>(elemIter->second);
-        
-        // Задание не планировалось к ожиданию.
-        THREAD_POOL_ASSERT("Task cannot be waited",
-                           task->IsWaitable);
-
-        // Задание ещё не выполнено.
-        THREAD_POOL_ASSERT("Task have not done yet",
-                           task->IsDone);
+        Task<RetType>* task = static_cast<Task<RetType>*>(Results.Extract(id));
 
         THREAD_POOL_PRINTF("ThreadPool: getting task %zd result\n", task->Id);
-        RetType retValue = task->GetResult();
 
-        // Освобождаем ресурсы, занимаемые заданием.
-        delete task;
-        TasksInProgress.erase(elemIter);
+        // Освобождаем ресурсы, занимаемые заданием, в том числе при исключении в задании.
+        // Если задание ещё ожидают в Wait(), то его удалит последний ожидающий.
+        std::unique_ptr<Task<RetType>, void (*)(TrackedTaskBase* const)> taskOwner(task, ReleaseTask);
+        return task->GetResult();
+    }
+
+    template <typename QueuePolicy, typename WaitPolicy, typename ResultPolicy, typename AllocPolicy,
+              typename FeaturesPolicy>
+    void BasicThreadPool<QueuePolicy, WaitPolicy, ResultPolicy, AllocPolicy, FeaturesPolicy>::Wait(TaskId id)
+    {
+        static_assert(WaitPolicy::IsEnabled, "ThreadPool does not support waiting for a task");
+
+        // Ожидаемые задания находятся в таблице с момента добавления и до вызова GetTaskResult().
+        // Захваченная ссылка не даёт GetTaskResult() в другом потоке удалить задание во время ожидания.
+        TrackedTaskBase* const task = Results.Acquire(id);
+
+        // Попытка ожидания не существующего задания или задания, которое нельзя ожидать => ошибка.
+        THREAD_POOL_ASSERT("Attempt to wait for not existing or not waitable task",
+                           task != nullptr);
+
+        std::unique_ptr<TrackedTaskBase, void (*)(TrackedTaskBase* const)> taskRef(task, ReleaseTask);
+        Waits.Wait(*task);
+    }
+
+    template <typename QueuePolicy, typename WaitPolicy, typename ResultPolicy, typename AllocPolicy,
+              typename FeaturesPolicy>
+    void BasicThreadPool<QueuePolicy, WaitPolicy, ResultPolicy, AllocPolicy, FeaturesPolicy>::ReleaseTask(
+        TrackedTaskBase* const task)
+    {
+        if (ResultPolicy::Release(task))
+            AllocPolicy::Delete(task);
+    }
+
+    template <typename QueuePolicy, typename WaitPolicy, typename ResultPolicy, typename AllocPolicy,
+              typename FeaturesPolicy>
+    bool BasicThreadPool<QueuePolicy, WaitPolicy, ResultPolicy, AllocPolicy, FeaturesPolicy>::IsWaitableTask(
+        TaskBase* const task)
+    {
+        // Без таблицы результатов задания TrackedTaskBase не создаются.
+        if constexpr (ResultPolicy::IsEnabled)
+            return static_cast<TrackedTaskBase*>(task)->IsWaitable;
+        else
+            return false;
+    }
+
+    template <typename QueuePolicy, typename WaitPolicy, typename ResultPolicy, typename AllocPolicy,
+              typename FeaturesPolicy>
+    AsyncFileIo& BasicThreadPool<QueuePolicy, WaitPolicy, ResultPolicy, AllocPolicy, FeaturesPolicy>::EnableAsyncIo(
+        const AsyncIoSettings& settings)
+    {
+        static_assert(FeaturesPolicy::IsAsyncIoEnabled, "ThreadPool does not support asynchronous I/O");
+        return ThreadPoolBase::EnableAsyncIo(settings);
+    }
 
-        return retValue;
+    template <typename QueuePolicy, typename WaitPolicy, typename ResultPolicy, typename AllocPolicy,
+              typename FeaturesPolicy>
+    FiberRuntime& BasicThreadPool<QueuePolicy, WaitPolicy, ResultPolicy, AllocPolicy, FeaturesPolicy>::EnableFibers(
+        const FiberSettings& settings)
+    {
+        static_assert(FeaturesPolicy::IsFibersEnabled, "ThreadPool does not support fibers");
+        return ThreadPoolBase::EnableFibers(settings);
     }
 
     ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
     ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
-    
+
+    template <typename QueuePolicy, typename WaitPolicy, typename ResultPolicy, typename AllocPolicy,
+              typename FeaturesPolicy>
+    void BasicThreadPool<QueuePolicy, WaitPolicy, ResultPolicy, AllocPolicy, FeaturesPolicy>::OnRunningThread(
+        ThreadHandler& handler)
+    {
+        const size_t handlerIndex    = handler.GetIndex();
+        size_t       tasksSinceYield = 0;
+
+        // Проверки выключенных в FeaturesPolicy возможностей не компилируются.
+        while (!IsTerminating.load(std::memory_order_relaxed))
+        {
+            // Продолжения завершённых операций ввода-вывода выполняются раньше новых заданий,
+            // чтобы операции не простаивали, пока потоки заняты.
+            if constexpr (FeaturesPolicy::IsAsyncIoEnabled)
+            {
+                if (PollCompletions(handler) != 0)
+                    continue;
+            }
+
+            // Волокна, дождавшиеся своих заданий, продолжаются раньше новых заданий, чтобы
+            // не накапливать приостановленные стеки.
+            if constexpr (FeaturesPolicy::IsFibersEnabled)
+            {
+                if (ResumeReadyFiber(handler))
+                    continue;
+            }
+
+            // Задания, адресованные этому потоку, выполняются раньше заданий из общей очереди.
+            TaskBase* taskToDo = nullptr;
+            if constexpr (FeaturesPolicy::IsAffinityEnabled)
+                taskToDo = TryPopMailbox(handlerIndex);
+
+            if (taskToDo == nullptr)
+                taskToDo = Queue.TryPop();
+
+            if constexpr (FeaturesPolicy::IsAffinityEnabled)
+            {
+                if (taskToDo == nullptr)
+                    taskToDo = TryStealMailbox(handler);
+            }
+
+            if (taskToDo == nullptr)
+            {
+                if constexpr (FeaturesPolicy::IsAffinityEnabled)
+                {
+                    if (WaitForStealableTasks())
+                        continue;
+                }
+
+                // Ожидаем появления задач в очереди или завершения работы ThreadPool.
+                const bool isStillRunning = ParkHandler(handler, [this, &handler]()
+                {
+                    return (FeaturesPolicy::IsAffinityEnabled && HasMailboxTasks(handler)) ||
+                           !Queue.IsEmpty() ||
+                           (FeaturesPolicy::IsFibersEnabled && HasReadyFibers(handler));
+                });
+
+                if (!isStillRunning)
+                    return;
+                continue;
+            }
+
+            if constexpr (FeaturesPolicy::IsFibersEnabled)
+            {
+                if (UsesFibers())
+                    RunTaskOnFiber(handler, taskToDo);
+                else
+                    RunTask(handler, taskToDo);
+            }
+            else
+                RunTask(handler, taskToDo);
+
+            if constexpr (FeaturesPolicy::IsArenaEnabled)
+            {
+                if (Arena != nullptr && ++tasksSinceYield >= ArenaYieldInterval)
+                {
+                    tasksSinceYield = 0;
+                    if (YieldToArena(handler))
+                        return;
+                }
+            }
+        }
+    }
+
+    template <typename QueuePolicy, typename WaitPolicy, typename ResultPolicy, typename AllocPolicy,
+              typename FeaturesPolicy>
+    void BasicThreadPool<QueuePolicy, WaitPolicy, ResultPolicy, AllocPolicy, FeaturesPolicy>::RunTask(
+        ThreadHandler& handler, TaskBase* const task)
+    {
+        THREAD_POOL_PRINTF("Thread #%zd is starting task %zd\n", handler.GetIndex(), task->Id);
+        try
+        {
+            task->Execute();
+        }
+        catch (...)
+        {
+            // Исключение ожидаемого задания сохраняет std::packaged_task, его получит
+            // GetTaskResult(). Исключение не ожидаемого задания передать некому, поэтому оно
+            // отбрасывается, а задание учитывается как выполненное.
+            THREAD_POOL_PRINTF("Thread #%zd: task %zd threw an exception\n", handler.GetIndex(), task->Id);
+        }
+
+        FinishTask(handler, task);
+    }
+
+    template <typename QueuePolicy, typename WaitPolicy, typename ResultPolicy, typename AllocPolicy,
+              typename FeaturesPolicy>
+    void BasicThreadPool<QueuePolicy, WaitPolicy, ResultPolicy, AllocPolicy, FeaturesPolicy>::FinishTask(
+        ThreadHandler& handler, TaskBase* const task)
+    {
+        THREAD_POOL_PRINTF("Thread #%zd have done task %zd\n", handler.GetIndex(), task->Id);
+
+        handler.IncDoneTasksCount();
+
+        if (IsWaitableTask(task))
+        {
+            const TaskId taskId = task->Id;
+
+            // После этой записи задание может быть удалено в GetTaskResult(), поэтому дальше
+            // к нему не обращаемся.
+            static_cast<TrackedTaskBase*>(task)->IsDone.store(true);
+
+            if constexpr (WaitPolicy::IsEnabled)
+                Waits.OnTaskDone(taskId);
+        }
+        else
+        {
+            // Результат задания никто не будет ожидать и получать, освобождаем ресурсы.
+            AllocPolicy::Delete(task);
+        }
+
+        OnTaskFinished();
+    }
+
+    template <typename QueuePolicy, typename WaitPolicy, typename ResultPolicy, typename AllocPolicy,
+              typename FeaturesPolicy>
+    void BasicThreadPool<QueuePolicy, WaitPolicy, ResultPolicy, AllocPolicy, FeaturesPolicy>::FinishFiberTask(
+        ThreadHandler& handler, TaskBase* const task)
+    {
+        FinishTask(handler, task);
+    }
+
+    ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+    ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
+    template <typename HasWorkFunct>
+    bool ThreadPoolBase::ParkHandler(ThreadHandler& handler, HasWorkFunct hasWork)
+    {
+        const uint32_t wakeSignal = handler.WakeSignal.load(std::memory_order_acquire);
+
+        {
+            std::unique_lock<std::mutex> lock(IdleHandlersAccess);
+            IdleHandlers.push_back(&handler);
+            IdleHandlersCount.fetch_add(1);
+        }
+
+        // Добавляющий задание поток сначала публикует задание, затем проверяет
+        // IdleHandlersCount. Мы делаем наоборот, поэтому хотя бы один из нас увидит другого.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (IsTerminating.load(std::memory_order_relaxed) || hasWork())
+        {
+            // Если поток уже удалили из списка, то его разбудили. Сигнал будет проигнорирован
+            // при следующем засыпании, так как значение WakeSignal считывается заново.
+            RemoveIdleHandler(handler);
+            return true;
+        }
+
+        // Один из спящих потоков ожидает завершения операций ввода-вывода.
+        AsyncFileIo* const asyncIo  = AsyncIo.load(std::memory_order_acquire);
+        ThreadHandler*     noWaiter = nullptr;
+        if (asyncIo != nullptr && asyncIo->HasPendingOperations() &&
+            CompletionsWaiter.compare_exchange_strong(noWaiter, &handler))
+        {
+            // SignalHandler() сначала изменяет WakeSignal, затем проверяет CompletionsWaiter.
+            // Мы делаем наоборот, поэтому сигнал либо будет замечен здесь, либо прервёт ожидание.
+            if (handler.WakeSignal.load() == wakeSignal)
+                asyncIo->WaitCompletions();
+
+            CompletionsWaiter.store(nullptr);
+            RemoveIdleHandler(handler);
+            return true;
+        }
+
+        if (Arena != nullptr)
+        {
+            // Сигнал уже пришёл, продолжаем работу в текущем потоке.
+            if (handler.WakeSignal.load() != wakeSignal)
+                return true;
+
+            // Возвращаем поток в WorkerArena. Обработчик остаётся в списке спящих. Флаг
+            // IsParkedInArena установит поток WorkerArena после завершения цикла, после этого
+            // SignalHandler() снова добавит обработчик в очередь WorkerArena.
+            handler.ArenaExitReason  = ThreadHandler::ArenaExit::Parked;
+            handler.ParkedWakeSignal = wakeSignal;
+            return false;
+        }
+
+        handler.WakeSignal.wait(wakeSignal, std::memory_order_acquire);
+        return true;
+    }
+
+    ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+    ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
+
     template <typename RetType>
-    Task<RetType>::Task(std::packaged_task<RetType()>&& packagedTask) :
-        TaskBase(),
-        PackagedTask(std::move(packagedTask)),
+    template <typename Callable>
+    Task<RetType>::Task(const TaskId id, Callable&& callable) :
+        TrackedTaskBase(id),
+        PackagedTask(std::forward<Callable>(callable)),
         Result(PackagedTask.get_future())
     {
     }
@@ -110,7 +540,20 @@ namespace ThreadPoolModule
     {
         return Result.get();
     }
+
+    template <typename Callable, typename BaseType>
+    CallableTask<Callable, BaseType>::CallableTask(const TaskId id, Callable&& callable) :
+        BaseType(id),
+        Funct(std::move(callable))
+    {
+    }
+
+    template <typename Callable, typename BaseType>
+    void CallableTask<Callable, BaseType>::Execute()
+    {
+        Funct();
+    }
 }
 
 ///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
-///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///
\ No newline at end of file
+///***///***///---\\\***\\\***\\\___///***___***\\\___///***///***///---\\\***\\\***///